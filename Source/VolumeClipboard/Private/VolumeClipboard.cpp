@@ -6,6 +6,9 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SNumericEntryBox.h"
+#include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SEditableTextBox.h"
 #include "ToolMenus.h"
 #include "GameFramework/Volume.h"
 #include "Components/BrushComponent.h"
@@ -30,6 +33,7 @@
 #include "Dom/JsonObject.h" 
 #include "HAL/PlatformApplicationMisc.h"
 #include "Editor/UnrealEdEngine.h"
+#include "Editor/Transactor.h"
 #include "UnrealEdGlobals.h"
 #include "EditorStyleSet.h" 
 #include "BSPOps.h" 
@@ -41,8 +45,32 @@
 #include "Engine/LevelStreamingDynamic.h" 
 #include "Engine/LevelStreamingVolume.h"  
 #include "EditorLevelUtils.h"             
-#include "Misc/MessageDialog.h"           
+#include "Misc/MessageDialog.h"
+#include "Misc/ScopedSlowTask.h"           
 #include "Misc/PackageName.h"
+#include "Engine/StreamableManager.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/BufferReader.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
+#include "Framework/Application/SlateApplication.h"
+#include "VolumeClipboardTypes.h"
+#include "VolumeClipboardBinary.h"
+#include "VolumeClipboardJson.h"
+#include "VolumeClipboardGeometry.h"
+#include "VolumeClipboardProperties.h"
+#include "VolumeClipboardBrush.h"
+
+DEFINE_LOG_CATEGORY(LogVolumeClipboard);
 
 static const FName VolumeClipboardTabName("VolumeClipboard");
 
@@ -52,16 +80,71 @@ void FVolumeClipboardModule::StartupModule()
 {
 	bPasteToOriginalLevel = true;
 	bDeleteOriginalActor = true;
+	bUseBinaryFormat = true;
+	WeldTolerance = 0.01f;
+	bDeltaFromDefaults = true;
+	bBatchLevelLoading = true;
+	bSimplifyGeometry = false;
+	bBulkPaste = true;
+	bUpdateExisting = true;
+	bCompactUndo = true;
+	bDetectPrimitives = true;
+	bBackgroundExtraction = true;
+	BspQuality = FBSPOps::BSP_Good;
+
+	for (int32 Quality : { (int32)FBSPOps::BSP_Lame, (int32)FBSPOps::BSP_Good, (int32)FBSPOps::BSP_Optimal })
+	{
+		BspQualityOptions.Add(MakeShared<int32>(Quality));
+	}
 
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(VolumeClipboardTabName, FOnSpawnTab::CreateRaw(this, &FVolumeClipboardModule::OnSpawnPluginTab))
 		.SetDisplayName(LOCTEXT("VolumeClipboardTabTitle", "Volume Tools"))
 		.SetMenuType(ETabSpawnerMenuType::Hidden);
 
 	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FVolumeClipboardModule::RegisterMenus));
+
+	VolumeClipboardProperties::Startup();
+
+	BspBenchmarkCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("VolumeClipboard.BenchmarkBsp"),
+		TEXT("Times the old paste BSP build (BSP_Optimal + csgPrepMovingBrush) against the convex fast path on the selected volumes."),
+		FConsoleCommandDelegate::CreateRaw(this, &FVolumeClipboardModule::BenchmarkBspBuild),
+		ECVF_Default);
+
+	PropertyBenchmarkCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("VolumeClipboard.BenchmarkProperties"),
+		TEXT("Times text (ExportTextItem/ImportText) against typed encoding of scalar volume properties. Optional argument: iterations (default 10000)."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&VolumeClipboardProperties::Benchmark),
+		ECVF_Default);
+
+	WorldExportCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("VolumeClipboard.ExportWorld"),
+		TEXT("Exports the volumes of all loaded levels, one file per level. Args: [Directory] [Class=] [Name=] [Levels=A,B] [Min=X,Y,Z Max=X,Y,Z]"),
+		FConsoleCommandWithArgsDelegate::CreateRaw(this, &FVolumeClipboardModule::ExportWorldCommand),
+		ECVF_Default);
 }
 
 void FVolumeClipboardModule::ShutdownModule()
 {
+	FlushPendingExtractions();
+
+	VolumeClipboardProperties::Shutdown();
+
+	if (BspBenchmarkCommand)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(BspBenchmarkCommand);
+		BspBenchmarkCommand = nullptr;
+	}
+	if (PropertyBenchmarkCommand)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(PropertyBenchmarkCommand);
+		PropertyBenchmarkCommand = nullptr;
+	}
+	if (WorldExportCommand)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(WorldExportCommand);
+		WorldExportCommand = nullptr;
+	}
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(VolumeClipboardTabName);
@@ -87,6 +170,192 @@ ECheckBoxState FVolumeClipboardModule::GetDeleteOriginalCheckboxState() const
 {
 	return bDeleteOriginalActor ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
+
+void FVolumeClipboardModule::OnBinaryFormatCheckboxChanged(ECheckBoxState NewState)
+{
+	bUseBinaryFormat = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetBinaryFormatCheckboxState() const
+{
+	return bUseBinaryFormat ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnDeltaPropertiesCheckboxChanged(ECheckBoxState NewState)
+{
+	bDeltaFromDefaults = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetDeltaPropertiesCheckboxState() const
+{
+	return bDeltaFromDefaults ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnBatchLevelsCheckboxChanged(ECheckBoxState NewState)
+{
+	bBatchLevelLoading = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetBatchLevelsCheckboxState() const
+{
+	return bBatchLevelLoading ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnUpdateExistingCheckboxChanged(ECheckBoxState NewState)
+{
+	bUpdateExisting = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetUpdateExistingCheckboxState() const
+{
+	return bUpdateExisting ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnCompactUndoCheckboxChanged(ECheckBoxState NewState)
+{
+	bCompactUndo = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetCompactUndoCheckboxState() const
+{
+	return bCompactUndo ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnBulkPasteCheckboxChanged(ECheckBoxState NewState)
+{
+	bBulkPaste = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetBulkPasteCheckboxState() const
+{
+	return bBulkPaste ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnSimplifyGeometryCheckboxChanged(ECheckBoxState NewState)
+{
+	bSimplifyGeometry = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetSimplifyGeometryCheckboxState() const
+{
+	return bSimplifyGeometry ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnDetectPrimitivesCheckboxChanged(ECheckBoxState NewState)
+{
+	bDetectPrimitives = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetDetectPrimitivesCheckboxState() const
+{
+	return bDetectPrimitives ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void FVolumeClipboardModule::OnBackgroundExtractionCheckboxChanged(ECheckBoxState NewState)
+{
+	bBackgroundExtraction = (NewState == ECheckBoxState::Checked);
+}
+
+ECheckBoxState FVolumeClipboardModule::GetBackgroundExtractionCheckboxState() const
+{
+	return bBackgroundExtraction ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+// --- TEXT HANDLERS ---
+void FVolumeClipboardModule::OnWorldClassFilterChanged(const FText& NewText)
+{
+	WorldClassFilter = NewText.ToString().TrimStartAndEnd();
+}
+
+FText FVolumeClipboardModule::GetWorldClassFilter() const
+{
+	return FText::FromString(WorldClassFilter);
+}
+
+void FVolumeClipboardModule::OnWorldNameFilterChanged(const FText& NewText)
+{
+	WorldNameFilter = NewText.ToString().TrimStartAndEnd();
+}
+
+FText FVolumeClipboardModule::GetWorldNameFilter() const
+{
+	return FText::FromString(WorldNameFilter);
+}
+
+void FVolumeClipboardModule::OnWorldLevelFilterChanged(const FText& NewText)
+{
+	WorldLevelFilter = NewText.ToString().TrimStartAndEnd();
+}
+
+FText FVolumeClipboardModule::GetWorldLevelFilter() const
+{
+	return FText::FromString(WorldLevelFilter);
+}
+
+void FVolumeClipboardModule::OnWeldToleranceChanged(float NewValue)
+{
+	WeldTolerance = FMath::Max(NewValue, 0.0f);
+}
+
+TOptional<float> FVolumeClipboardModule::GetWeldTolerance() const
+{
+	return WeldTolerance;
+}
+
+// --- COMBO HANDLERS ---
+static FText GetBspQualityDisplayName(int32 Quality)
+{
+	switch (Quality)
+	{
+	case FBSPOps::BSP_Lame: return LOCTEXT("BspQualityLame", "Lame (fastest)");
+	case FBSPOps::BSP_Optimal: return LOCTEXT("BspQualityOptimal", "Optimal (slowest)");
+	default: return LOCTEXT("BspQualityGood", "Good");
+	}
+}
+
+TSharedRef<SWidget> FVolumeClipboardModule::OnGenerateBspQualityWidget(TSharedPtr<int32> Option) const
+{
+	return SNew(STextBlock).Text(GetBspQualityDisplayName(Option.IsValid() ? *Option : (int32)FBSPOps::BSP_Good));
+}
+
+void FVolumeClipboardModule::OnBspQualityChanged(TSharedPtr<int32> NewValue, ESelectInfo::Type SelectInfo)
+{
+	if (NewValue.IsValid())
+	{
+		BspQuality = *NewValue;
+	}
+}
+
+FText FVolumeClipboardModule::GetBspQualityText() const
+{
+	return GetBspQualityDisplayName(BspQuality);
+}
+
+FVolumeCaptureOptions FVolumeClipboardModule::MakeCaptureOptions(bool bForBinary) const
+{
+	FVolumeCaptureOptions Options;
+	Options.bTypedValues = bForBinary;
+	Options.WeldTolerance = WeldTolerance;
+	Options.bDeltaFromDefaults = bDeltaFromDefaults;
+	Options.bSimplifyGeometry = bSimplifyGeometry;
+	Options.bDetectPrimitives = bDetectPrimitives;
+	return Options;
+}
+
+FVolumeWorldFilter FVolumeClipboardModule::MakeWorldFilter() const
+{
+	FVolumeWorldFilter Filter;
+	Filter.ClassName = WorldClassFilter;
+	Filter.NamePattern = WorldNameFilter;
+
+	WorldLevelFilter.ParseIntoArray(Filter.Levels, TEXT(","));
+	for (FString& Level : Filter.Levels)
+	{
+		Level.TrimStartAndEndInline();
+	}
+	Filter.Levels.RemoveAll([](const FString& Level) { return Level.IsEmpty(); });
+	return Filter;
+}
 // -------------------------
 
 TSharedRef<SDockTab> FVolumeClipboardModule::OnSpawnPluginTab(const FSpawnTabArgs& SpawnTabArgs)
@@ -115,6 +384,119 @@ TSharedRef<SDockTab> FVolumeClipboardModule::OnSpawnPluginTab(const FSpawnTabArg
 						.Text(LOCTEXT("ExtractBtn", "Copy Selected Volumes"))
 						.OnClicked(FOnClicked::CreateRaw(this, &FVolumeClipboardModule::OnExtractVolumesClicked))
 				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetBinaryFormatCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnBinaryFormatCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("BinaryFmtChk", "Compact Binary Format"))
+								.ToolTipText(LOCTEXT("BinaryFmtTip", "If checked, copies volumes as a compact binary archive. If unchecked, copies readable JSON (slower, for debugging / other tools). Paste accepts both."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetDeltaPropertiesCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnDeltaPropertiesCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("DeltaPropsChk", "Only Copy Changed Properties"))
+								.ToolTipText(LOCTEXT("DeltaPropsTip", "If checked, only properties that differ from the class defaults are copied. Pasted volumes start from the defaults, so the result is the same with a much smaller payload."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetDetectPrimitivesCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnDetectPrimitivesCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("DetectPrimsChk", "Copy Box Brushes as Builder Parameters"))
+								.ToolTipText(LOCTEXT("DetectPrimsTip", "If checked, brushes that are plain boxes are copied as their cube builder size instead of polys. Pasted volumes are rebuilt from the size and keep a Cube brush builder."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetBackgroundExtractionCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnBackgroundExtractionCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("BackgroundExtractChk", "Encode Copies in the Background"))
+								.ToolTipText(LOCTEXT("BackgroundExtractTip", "If checked, copy and export only take a snapshot of the volumes on the editor thread. Geometry cleanup, formatting and file writes run on worker threads and the clipboard is filled when they finish."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("WeldTolLabel", "BSP Weld Tolerance"))
+								.ToolTipText(LOCTEXT("WeldTolTip", "Cooked volumes (BSP nodes only) are exported as shared points. Points closer than this are merged. 0 disables welding."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							SNew(SNumericEntryBox<float>)
+								.MinValue(0.0f)
+								.Value_Raw(this, &FVolumeClipboardModule::GetWeldTolerance)
+								.OnValueChanged_Raw(this, &FVolumeClipboardModule::OnWeldToleranceChanged)
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetSimplifyGeometryCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnSimplifyGeometryCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("SimplifyChk", "Merge Coplanar BSP Fragments"))
+								.ToolTipText(LOCTEXT("SimplifyTip", "If checked, cooked volumes have their split BSP fragments merged back into convex faces and slivers removed before copying. Volumes whose enclosed space would change are copied unmodified."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("BspQualityLabel", "Non-Convex BSP Quality"))
+								.ToolTipText(LOCTEXT("BspQualityTip", "Convex brushes get their BSP built directly. Other brushes are rebuilt with bspBuild at this quality."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							SNew(SComboBox<TSharedPtr<int32>>)
+								.OptionsSource(&BspQualityOptions)
+								.OnGenerateWidget_Raw(this, &FVolumeClipboardModule::OnGenerateBspQualityWidget)
+								.OnSelectionChanged_Raw(this, &FVolumeClipboardModule::OnBspQualityChanged)
+								[
+									SNew(STextBlock)
+										.Text_Raw(this, &FVolumeClipboardModule::GetBspQualityText)
+								]
+						]
+				]
 			+ SVerticalBox::Slot()
 				.AutoHeight()
 				.Padding(10, 2)
@@ -141,6 +523,58 @@ TSharedRef<SDockTab> FVolumeClipboardModule::OnSpawnPluginTab(const FSpawnTabArg
 								.ToolTipText(LOCTEXT("DelOrigTip", "If checked, attempts to delete existing actors with the same name before pasting to prevent duplicates."))
 						]
 				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetUpdateExistingCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnUpdateExistingCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("UpdateExistingChk", "Update Existing Actors In Place"))
+								.ToolTipText(LOCTEXT("UpdateExistingTip", "Only used with Delete Original Actors. If checked, an existing actor of the same class is updated with the pasted brush, transform and properties instead of being destroyed and respawned. Actors of a different class are still replaced."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetBatchLevelsCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnBatchLevelsCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("BatchLevelsChk", "Load Missing Levels Together"))
+								.ToolTipText(LOCTEXT("BatchLevelsTip", "If checked, missing sub-levels are confirmed once, loaded asynchronously in one batch and attached with a single streaming flush. If unchecked, each level is prompted for and loaded one at a time."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetBulkPasteCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnBulkPasteCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("BulkPasteChk", "Bulk Paste"))
+								.ToolTipText(LOCTEXT("BulkPasteTip", "If checked, pasted volumes are spawned in place without per-actor edit notifications. Components, bounds and the selection are updated once after all volumes exist. Uncheck to notify the editor after every volume."))
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SCheckBox)
+						.IsChecked(TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateRaw(this, &FVolumeClipboardModule::GetCompactUndoCheckboxState)))
+						.OnCheckStateChanged_Raw(this, &FVolumeClipboardModule::OnCompactUndoCheckboxChanged)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("CompactUndoChk", "Compact Undo"))
+								.ToolTipText(LOCTEXT("CompactUndoTip", "If checked, the undo record of a paste only tracks the created volumes and the levels they were added to, not full copies of every new brush. Keeps editor memory flat on very large pastes."))
+						]
+				]
 			+ SVerticalBox::Slot()
 				.AutoHeight()
 				.Padding(10, 5)
@@ -152,677 +586,1987 @@ TSharedRef<SDockTab> FVolumeClipboardModule::OnSpawnPluginTab(const FSpawnTabArg
 						.Text(LOCTEXT("CreateBtn", "Paste Volumes"))
 						.OnClicked(FOnClicked::CreateRaw(this, &FVolumeClipboardModule::OnCreateVolumesClicked))
 				]
-		];
-}
-
-void FVolumeClipboardModule::RegisterMenus()
-{
-	FToolMenuOwnerScoped OwnerScoped(this);
-	UToolMenus* ToolMenus = UToolMenus::Get();
-	if (!ToolMenus) return;
-
-	UToolMenu* ToolbarMenu = ToolMenus->ExtendMenu("LevelEditor.LevelEditorToolBar");
-	if (!ToolbarMenu) return;
-
-	FToolMenuSection& Section = ToolbarMenu->FindOrAddSection("Settings");
-
-	Section.AddEntry(FToolMenuEntry::InitToolBarButton(
-		"OpenVolumeTool",
-		FUIAction(FExecuteAction::CreateRaw(this, &FVolumeClipboardModule::OpenPluginWindow)),
-		LOCTEXT("VolumeToolBtn", "Volume Tools"),
-		LOCTEXT("VolumeToolTooltip", "Open Volume Copy/Paste Tools"),
-		FSlateIcon(FEditorStyle::GetStyleSetName(), "LevelEditor.Tabs.Details")
-	));
-}
-
-void FVolumeClipboardModule::OpenPluginWindow()
-{
-	FGlobalTabmanager::Get()->TryInvokeTab(VolumeClipboardTabName);
-}
-
-// ---------------------------------------------------------
-// HELPER: Property Filtering
-// ---------------------------------------------------------
-static bool IsPropertySafeToCopy(FProperty* Property, UObject* Container)
-{
-	FString Name = Property->GetName();
-
-	if (Name.Contains("Guid") || Name.Contains("Cookie") || Name.StartsWith("bHidden") ||
-		Name == "Brush" || Name == "BrushComponent" || Name == "RootComponent" ||
-		Name == "Model" || Name == "BrushBuilder" || Name == "ActorLabel" ||
-		Name == "Owner" || Name == "Instigator" || Name == "SavedSelections" ||
-		Name == "RelativeLocation" || Name == "RelativeRotation" || Name == "RelativeScale3D" ||
-		Name == "Rotation" || Name == "Location" || Name == "PhysicsTransform" ||
-		Name == "ReplicatedMovement" || Name == "SpriteScale" || Name == "PivotOffset" ||
-		Name == "PrePivot" || Name == "Tags" || Name == "Layers" || Name == "InputPriority")
-	{
-		return false;
-	}
-
-	if (Property->IsA(FNumericProperty::StaticClass())) return true;
-	if (Property->IsA(FBoolProperty::StaticClass())) return true;
-	if (Property->IsA(FStrProperty::StaticClass())) return true;
-	if (Property->IsA(FNameProperty::StaticClass())) return true;
-	if (Property->IsA(FTextProperty::StaticClass())) return true;
-	if (Property->IsA(FEnumProperty::StaticClass())) return true;
-	if (Property->IsA(FStructProperty::StaticClass())) return true;
-	if (Property->IsA(FArrayProperty::StaticClass())) return true;
-	if (Property->IsA(FObjectPropertyBase::StaticClass())) return true;
-	if (Property->IsA(FInterfaceProperty::StaticClass())) return true;
-
-	return false;
-}
-
-static FString DoubleToPrecisionString(double Val)
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 5)
+				[
+					SNew(SButton)
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						.ContentPadding(FMargin(10, 5))
+						.Text(LOCTEXT("ExportFileBtn", "Export to File..."))
+						.ToolTipText(LOCTEXT("ExportFileTip", "Writes the selected volumes to a .vclb archive or .json file, bypassing the clipboard."))
+						.OnClicked(FOnClicked::CreateRaw(this, &FVolumeClipboardModule::OnExportToFileClicked))
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 5)
+				[
+					SNew(SButton)
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						.ContentPadding(FMargin(10, 5))
+						.Text(LOCTEXT("ImportFileBtn", "Import from File..."))
+						.ToolTipText(LOCTEXT("ImportFileTip", "Pastes volumes from a .vclb archive or .json file using the options above."))
+						.OnClicked(FOnClicked::CreateRaw(this, &FVolumeClipboardModule::OnImportFromFileClicked))
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("WorldClassLabel", "World Export Class"))
+								.ToolTipText(LOCTEXT("WorldClassTip", "Only volumes of this class or its subclasses are exported. Class name (TriggerVolume) or blueprint class path. Empty exports every volume class."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							SNew(SEditableTextBox)
+								.HintText(LOCTEXT("WorldClassHint", "Any class"))
+								.Text_Raw(this, &FVolumeClipboardModule::GetWorldClassFilter)
+								.OnTextChanged_Raw(this, &FVolumeClipboardModule::OnWorldClassFilterChanged)
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("WorldNameLabel", "World Export Name"))
+								.ToolTipText(LOCTEXT("WorldNameTip", "Wildcard (* and ?) matched against the actor name and label. Empty exports every name."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							SNew(SEditableTextBox)
+								.HintText(LOCTEXT("WorldNameHint", "Any name"))
+								.Text_Raw(this, &FVolumeClipboardModule::GetWorldNameFilter)
+								.OnTextChanged_Raw(this, &FVolumeClipboardModule::OnWorldNameFilterChanged)
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 2)
+				[
+					SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						.VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+								.Text(LOCTEXT("WorldLevelsLabel", "World Export Levels"))
+								.ToolTipText(LOCTEXT("WorldLevelsTip", "Comma separated level names or package paths. Empty exports every loaded level."))
+						]
+						+ SHorizontalBox::Slot()
+						.FillWidth(1.0f)
+						[
+							SNew(SEditableTextBox)
+								.HintText(LOCTEXT("WorldLevelsHint", "All loaded levels"))
+								.Text_Raw(this, &FVolumeClipboardModule::GetWorldLevelFilter)
+								.OnTextChanged_Raw(this, &FVolumeClipboardModule::OnWorldLevelFilterChanged)
+						]
+				]
+			+ SVerticalBox::Slot()
+				.AutoHeight()
+				.Padding(10, 5)
+				[
+					SNew(SButton)
+						.HAlign(HAlign_Center)
+						.VAlign(VAlign_Center)
+						.ContentPadding(FMargin(10, 5))
+						.Text(LOCTEXT("ExportWorldBtn", "Export Level Volumes to Folder..."))
+						.ToolTipText(LOCTEXT("ExportWorldTip", "Writes every volume of the loaded levels that passes the filters above, one file per level. The selection is ignored and left untouched."))
+						.OnClicked(FOnClicked::CreateRaw(this, &FVolumeClipboardModule::OnExportWorldClicked))
+				]
+		];
+}
+
+void FVolumeClipboardModule::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(this);
+	UToolMenus* ToolMenus = UToolMenus::Get();
+	if (!ToolMenus) return;
+
+	UToolMenu* ToolbarMenu = ToolMenus->ExtendMenu("LevelEditor.LevelEditorToolBar");
+	if (!ToolbarMenu) return;
+
+	FToolMenuSection& Section = ToolbarMenu->FindOrAddSection("Settings");
+
+	Section.AddEntry(FToolMenuEntry::InitToolBarButton(
+		"OpenVolumeTool",
+		FUIAction(FExecuteAction::CreateRaw(this, &FVolumeClipboardModule::OpenPluginWindow)),
+		LOCTEXT("VolumeToolBtn", "Volume Tools"),
+		LOCTEXT("VolumeToolTooltip", "Open Volume Copy/Paste Tools"),
+		FSlateIcon(FEditorStyle::GetStyleSetName(), "LevelEditor.Tabs.Details")
+	));
+}
+
+void FVolumeClipboardModule::OpenPluginWindow()
+{
+	FGlobalTabmanager::Get()->TryInvokeTab(VolumeClipboardTabName);
+}
+
+// ---------------------------------------------------------
+// LOGIC: Serialization / Extraction
+// ---------------------------------------------------------
+
+void FVolumeClipboardModule::SerializeObjectProperties(UObject* Obj, const FVolumeCaptureOptions& Options, TArray<FVolumePropertyRecord>& OutProps)
+{
+	// Archetype of a placed actor is its class default (or blueprint default), components resolve to their template.
+	// Defaults must share the layout of Obj, otherwise fall back to a full export.
+	const UObject* Defaults = Options.bDeltaFromDefaults ? Obj->GetArchetype() : nullptr;
+	if (Defaults && !Defaults->IsA(Obj->GetClass()))
+	{
+		Defaults = nullptr;
+	}
+
+	// Filtered once per class, every later object of the class only exports values
+	for (const VolumeClipboardProperties::FCopyableProperty& Entry : VolumeClipboardProperties::GetCopyableProperties(Obj->GetClass()))
+	{
+		FProperty* Property = Entry.Property;
+
+		// Delta mode: values equal to the defaults are already there when the volume is spawned
+		if (Defaults && Property->Identical_InContainer(Obj, Defaults, 0, PPF_None)) continue;
+
+		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Obj);
+
+		// Scalars are copied raw, text export is left for structs, arrays, strings and references
+		if (Options.bTypedValues && Entry.Encoding != EVolumePropertyEncoding::Text)
+		{
+			FVolumePropertyRecord Prop;
+			VolumeClipboardProperties::ExportTypedValue(Entry, ValuePtr, Prop);
+			if (Defaults || Prop.Encoding != EVolumePropertyEncoding::Name || Prop.Value != TEXT("None"))
+			{
+				Prop.Name = Property->GetName();
+				OutProps.Add(MoveTemp(Prop));
+			}
+			continue;
+		}
+
+		FString StringValue;
+		Property->ExportTextItem(StringValue, ValuePtr, nullptr, Obj, PPF_None);
+
+		// An empty value that differs from the defaults is an override (e.g. a cleared reference) and must be kept
+		if (Defaults || (!StringValue.IsEmpty() && StringValue != "None" && StringValue != "()" && StringValue != "nullptr"))
+		{
+			FVolumePropertyRecord& Prop = OutProps.AddDefaulted_GetRef();
+			Prop.Name = Property->GetName();
+			Prop.Value = MoveTemp(StringValue);
+		}
+	}
+}
+
+// ---------------------------------------------------------
+// HELPER: Reset copyable properties that are not in a record back to the archetype.
+// Records may only carry values that differ from the defaults, so an updated-in-place
+// actor and its components need this to end up like freshly spawned ones.
+// ---------------------------------------------------------
+static void ResetUnlistedProperties(UObject* Obj, const TArray<FVolumePropertyRecord>& InProps)
+{
+	const UObject* Defaults = Obj->GetArchetype();
+	if (!Defaults || !Defaults->IsA(Obj->GetClass())) return;
+
+	TSet<FName> Listed;
+	Listed.Reserve(InProps.Num());
+	for (const FVolumePropertyRecord& Prop : InProps)
+	{
+		Listed.Add(FName(*Prop.Name, FNAME_Find));
+	}
+
+	for (const VolumeClipboardProperties::FCopyableProperty& Entry : VolumeClipboardProperties::GetCopyableProperties(Obj->GetClass()))
+	{
+		FProperty* Property = Entry.Property;
+		if (Listed.Contains(Property->GetFName()) || Property->Identical_InContainer(Obj, Defaults, 0, PPF_None)) continue;
+
+		Property->CopyCompleteValue_InContainer(Obj, Defaults);
+	}
+}
+
+void FVolumeClipboardModule::RestoreObjectProperties(UObject* Obj, const TArray<FVolumePropertyRecord>& InProps)
+{
+	const UClass* Class = Obj->GetClass();
+	for (const FVolumePropertyRecord& Prop : InProps)
+	{
+		// Resolved through the cached per-class plan, already filtered for safety
+		FProperty* Property = VolumeClipboardProperties::FindRestoreProperty(Class, Prop.Name);
+		if (!Property) continue;
+
+		void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Obj);
+		if (Prop.Encoding == EVolumePropertyEncoding::Text)
+		{
+			Property->ImportText(*Prop.Value, ValuePtr, 0, Obj);
+		}
+		else if (!VolumeClipboardProperties::ImportTypedValue(Property, ValuePtr, Prop))
+		{
+			// Class changed since the copy, the text form still has a chance to import
+			Property->ImportText(*Prop.GetValueText(), ValuePtr, 0, Obj);
+		}
+	}
+}
+
+void FVolumeClipboardModule::RestoreComponentProperties(AActor* Actor, const TArray<FVolumeComponentRecord>& InComponents, bool bResetUnlisted)
+{
+	if (InComponents.Num() == 0) return;
+
+	// Components of the same class are matched in order: the Nth record of a class goes to the Nth component of that class
+	TMap<FName, TArray<UActorComponent*, TInlineAllocator<2>>> ComponentsByClass;
+	for (UActorComponent* Comp : Actor->GetComponents())
+	{
+		if (Comp && !Comp->IsA(UBrushComponent::StaticClass()))
+		{
+			ComponentsByClass.FindOrAdd(Comp->GetClass()->GetFName()).Add(Comp);
+		}
+	}
+
+	TMap<FName, int32> NextOrdinal;
+	for (const FVolumeComponentRecord& CompRec : InComponents)
+	{
+		const FName ClassName(*CompRec.ClassName, FNAME_Find);
+		const auto* Candidates = ClassName.IsNone() ? nullptr : ComponentsByClass.Find(ClassName);
+		if (!Candidates) continue;
+
+		int32& Ordinal = NextOrdinal.FindOrAdd(ClassName);
+		if (Candidates->IsValidIndex(Ordinal))
+		{
+			UActorComponent* Comp = (*Candidates)[Ordinal];
+			if (bResetUnlisted)
+			{
+				Comp->Modify();
+				ResetUnlistedProperties(Comp, CompRec.Props);
+			}
+			RestoreObjectProperties(Comp, CompRec.Props);
+		}
+		Ordinal++;
+	}
+}
+
+// ---------------------------------------------------------
+// HELPER: Capture Context
+// ---------------------------------------------------------
+struct FVolumeCaptureContext
+{
+	UWorld* World = nullptr;
+
+	// Inverted EditorStreamingVolumes of every streaming level: volume -> (level package, slot), in world order
+	TMap<const ALevelStreamingVolume*, TArray<FVolumeStreamLinkRecord>> StreamLinks;
+
+	explicit FVolumeCaptureContext(UWorld* InWorld)
+		: World(InWorld)
+	{
+		if (!World) return;
+
+		// One pass over all links, instead of searching every streaming level for every captured volume
+		for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			if (!StreamingLevel) continue;
+
+			const FString PackageName = StreamingLevel->GetWorldAssetPackageName();
+			TSet<const ALevelStreamingVolume*> SeenInLevel;
+
+			for (int32 SlotIndex = 0; SlotIndex < StreamingLevel->EditorStreamingVolumes.Num(); SlotIndex++)
+			{
+				const ALevelStreamingVolume* StreamingVolume = StreamingLevel->EditorStreamingVolumes[SlotIndex];
+				bool bAlreadySeen = false;
+				SeenInLevel.Add(StreamingVolume, &bAlreadySeen);
+
+				// Only the first slot counts, like EditorStreamingVolumes.Find()
+				if (!StreamingVolume || bAlreadySeen) continue;
+
+				FVolumeStreamLinkRecord& Link = StreamLinks.FindOrAdd(StreamingVolume).AddDefaulted_GetRef();
+				Link.Package = PackageName;
+				Link.Slot = SlotIndex;
+			}
+		}
+	}
+};
+
+void FVolumeClipboardModule::CaptureVolume(AVolume* Volume, const FVolumeCaptureContext& Context, const FVolumeCaptureOptions& Options, FVolumeRecord& Rec)
+{
+	Rec.Class = Volume->GetClass()->GetPathName();
+	Rec.InternalName = Volume->GetName();
+
+	if (Volume->GetLevel())
+	{
+		UPackage* LevelPackage = Volume->GetLevel()->GetOutermost();
+		Rec.bHasOrigin = true;
+		Rec.OriginLevelPackage = LevelPackage->GetName();
+		Rec.OriginLevel = FPackageName::GetShortName(Rec.OriginLevelPackage);
+	}
+
+	if (Context.World && Cast<ALevelStreamingVolume>(Volume))
+	{
+		Rec.bHasStreamLinks = true;
+		if (const TArray<FVolumeStreamLinkRecord>* Links = Context.StreamLinks.Find(Cast<ALevelStreamingVolume>(Volume)))
+		{
+			Rec.StreamLinks = *Links;
+		}
+	}
+
+	Rec.Location = Volume->GetActorLocation();
+	Rec.Rotation = Volume->GetActorQuat();
+	Rec.Scale = Volume->GetActorScale3D();
+	Rec.bHasRotation = true;
+
+	Rec.bHasSpawnMethod = true;
+	Rec.SpawnMethod = (int32)Volume->SpawnCollisionHandlingMethod;
+	if (Volume->GetRootComponent())
+	{
+		Rec.bHasMobility = true;
+		Rec.Mobility = (int32)Volume->GetRootComponent()->Mobility;
+	}
+	Rec.bHasBrushType = true;
+	Rec.BrushType = (int32)Volume->BrushType;
+
+	SerializeObjectProperties(Volume, Options, Rec.Properties);
+
+	for (UActorComponent* Comp : Volume->GetComponents())
+	{
+		if (Comp->IsA(UBrushComponent::StaticClass())) continue;
+
+		FVolumeComponentRecord& CompRec = Rec.Components.AddDefaulted_GetRef();
+		CompRec.ClassName = Comp->GetClass()->GetName();
+		SerializeObjectProperties(Comp, Options, CompRec.Props);
+	}
+
+	UModel* Model = Volume->Brush;
+	if (!Model && Volume->GetBrushComponent()) Model = Volume->GetBrushComponent()->Brush;
+
+	if (Model)
+	{
+		Rec.bHasModel = true;
+
+		if (Model->Polys && Model->Polys->Element.Num() > 0)
+		{
+			for (const FPoly& Poly : Model->Polys->Element)
+			{
+				FVolumePolyRecord& PolyRec = Rec.Polys.AddDefaulted_GetRef();
+				PolyRec.Flags = Poly.PolyFlags;
+				PolyRec.FirstVertex = Rec.Vertices.Num();
+				PolyRec.NumVertices = Poly.Vertices.Num();
+				Rec.Vertices.Append(Poly.Vertices.GetData(), Poly.Vertices.Num());
+			}
+		}
+		else if (Model->Nodes.Num() > 0)
+		{
+			// Cooked brushes only have BSP nodes. Nodes share Model->Points, so each point is exported
+			// once and nodes reference it by index instead of carrying their own copies.
+			Rec.bIndexed = true;
+			TMap<int32, int32> PointRemap;
+
+			for (int32 i = 0; i < Model->Nodes.Num(); i++)
+			{
+				const FBspNode& Node = Model->Nodes[i];
+				if (Node.NumVertices < 3) continue;
+
+				FVolumePolyRecord& PolyRec = Rec.Polys.AddDefaulted_GetRef();
+				PolyRec.Flags = Node.NodeFlags;
+				PolyRec.FirstVertex = Rec.Indices.Num();
+				PolyRec.NumVertices = Node.NumVertices;
+
+				for (int32 v = 0; v < Node.NumVertices; v++)
+				{
+					int32 VertIndex = Model->Verts[Node.iVertPool + v].pVertex;
+
+					int32* PointIndex = PointRemap.Find(VertIndex);
+					if (!PointIndex)
+					{
+						PointIndex = &PointRemap.Add(VertIndex, Rec.Vertices.Add(Model->Points[VertIndex]));
+					}
+					Rec.Indices.Add(*PointIndex);
+				}
+			}
+		}
+	}
+
+	Rec.BuilderType = VolumeClipboardGeometry::CustomPolysBuilderType;
+}
+
+void FVolumeClipboardModule::FinishCapturedGeometry(const FVolumeCaptureOptions& Options, FVolumeRecord& Rec)
+{
+	// Only touches the record, so this runs on worker threads
+	if (Rec.bIndexed)
+	{
+		const int32 NumWelded = VolumeClipboardGeometry::WeldPoints(Rec, Options.WeldTolerance);
+		UE_LOG(LogVolumeClipboard, Verbose, TEXT("%s: %d BSP nodes -> %d shared points (%d welded)"), *Rec.InternalName, Rec.Polys.Num(), Rec.Vertices.Num(), NumWelded);
+
+		if (Options.bSimplifyGeometry)
+		{
+			const int32 NumNodes = Rec.Polys.Num();
+			if (VolumeClipboardGeometry::SimplifyPolys(Rec, Options.WeldTolerance) > 0)
+			{
+				UE_LOG(LogVolumeClipboard, Log, TEXT("%s: simplified %d BSP nodes to %d polys (%d points)"), *Rec.InternalName, NumNodes, Rec.Polys.Num(), Rec.Vertices.Num());
+			}
+		}
+	}
+
+	// Box brushes only need their size, the paste side rebuilds the six faces
+	FVector CubeSize;
+	uint32 CubeFlags = 0;
+	if (Options.bDetectPrimitives && VolumeClipboardGeometry::DetectCube(Rec, THRESH_POINT_ON_PLANE, CubeSize, CubeFlags))
+	{
+		UE_LOG(LogVolumeClipboard, Verbose, TEXT("%s: %d polys -> Cube %s"), *Rec.InternalName, Rec.Polys.Num(), *CubeSize.ToString());
+
+		Rec.BuilderType = VolumeClipboardGeometry::CubeBuilderType;
+		Rec.BuilderParams = { CubeSize.X, CubeSize.Y, CubeSize.Z };
+		Rec.BuilderFlags = CubeFlags;
+		Rec.bHasModel = false;
+		Rec.bIndexed = false;
+		Rec.Vertices.Empty();
+		Rec.Indices.Empty();
+		Rec.Polys.Empty();
+	}
+}
+
+static void GetSelectedVolumes(TArray<AVolume*>& OutVolumes)
+{
+	USelection* SelectedActors = GEditor->GetSelectedActors();
+	for (FSelectionIterator It(*SelectedActors); It; ++It)
+	{
+		AActor* Actor = Cast<AActor>(*It);
+		AVolume* Volume = Cast<AVolume>(Actor);
+
+		if (Volume)
+		{
+			OutVolumes.Add(Volume);
+		}
+	}
+}
+
+/** Volumes of one level that passed a world filter, in actor iteration order. */
+struct FLevelVolumes
+{
+	ULevel* Level = nullptr;
+	TArray<AVolume*> Volumes;
+};
+
+static bool GatherWorldVolumes(UWorld* World, const FVolumeWorldFilter& Filter, TArray<FLevelVolumes>& OutLevels)
+{
+	if (!World) return false;
+
+	UClass* FilterClass = AVolume::StaticClass();
+	if (!Filter.ClassName.IsEmpty())
+	{
+		UClass* Found = Filter.ClassName.Contains(TEXT("/")) ? LoadObject<UClass>(nullptr, *Filter.ClassName) : FindObject<UClass>(ANY_PACKAGE, *Filter.ClassName);
+		if (!Found || !Found->IsChildOf(AVolume::StaticClass()))
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("World export: '%s' is not a volume class."), *Filter.ClassName);
+			return false;
+		}
+		FilterClass = Found;
+	}
+
+	// Level names are resolved once, the actor loop only does a set lookup
+	TSet<const ULevel*> AllowedLevels;
+	for (const FString& LevelName : Filter.Levels)
+	{
+		bool bFound = false;
+		for (ULevel* Level : World->GetLevels())
+		{
+			if (!Level) continue;
+
+			const FString PackageName = Level->GetOutermost()->GetName();
+			if (PackageName.Equals(LevelName, ESearchCase::IgnoreCase) || FPackageName::GetShortName(PackageName).Equals(LevelName, ESearchCase::IgnoreCase))
+			{
+				AllowedLevels.Add(Level);
+				bFound = true;
+			}
+		}
+
+		if (!bFound)
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("World export: level '%s' is not loaded, skipped."), *LevelName);
+		}
+	}
+
+	if (Filter.Levels.Num() > 0 && AllowedLevels.Num() == 0) return false;
+
+	TMap<const ULevel*, int32> LevelIndices;
+	int32 NumVisited = 0;
+	int32 NumPassed = 0;
+
+	for (TActorIterator<AVolume> It(World, FilterClass); It; ++It)
+	{
+		AVolume* Volume = *It;
+		NumVisited++;
+
+		ULevel* Level = Volume->GetLevel();
+		if (!Level || (AllowedLevels.Num() > 0 && !AllowedLevels.Contains(Level))) continue;
+
+		if (!Filter.NamePattern.IsEmpty() && !Volume->GetName().MatchesWildcard(Filter.NamePattern) && !Volume->GetActorLabel().MatchesWildcard(Filter.NamePattern)) continue;
+
+		if (Filter.Bounds.IsValid && !Filter.Bounds.Intersect(Volume->GetComponentsBoundingBox(true))) continue;
+
+		int32* LevelIndex = LevelIndices.Find(Level);
+		if (!LevelIndex)
+		{
+			LevelIndex = &LevelIndices.Add(Level, OutLevels.Num());
+			OutLevels.AddDefaulted_GetRef().Level = Level;
+		}
+		OutLevels[*LevelIndex].Volumes.Add(Volume);
+		NumPassed++;
+	}
+
+	UE_LOG(LogVolumeClipboard, Log, TEXT("World export: %d of %d volumes in %d levels passed the filter."), NumPassed, NumVisited, OutLevels.Num());
+	return true;
+}
+
+// ---------------------------------------------------------
+// LOGIC: Background Extraction
+// ---------------------------------------------------------
+
+// UTF-16LE byte order mark. JSON files are written as UTF-16 text, which is TCHAR on most platforms,
+// so the mapped file can be parsed in place.
+static const uint8 JsonFileBom[2] = { 0xFF, 0xFE };
+
+/** Passes TCHAR text through to an archive as UTF-16, so the file body matches JsonFileBom where TCHAR is wider. */
+class FUtf16TextWriter : public FArchive
+{
+public:
+	explicit FUtf16TextWriter(FArchive& InInner)
+		: Inner(InInner)
+	{
+		SetIsSaving(true);
+	}
+
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		if (sizeof(TCHAR) == sizeof(UTF16CHAR))
+		{
+			Inner.Serialize(Data, Num);
+			return;
+		}
+
+		// The JSON writer only emits whole characters
+		const FTCHARToUTF16 Converted((const TCHAR*)Data, (int32)(Num / sizeof(TCHAR)));
+		Inner.Serialize((void*)Converted.Get(), Converted.Length() * sizeof(UTF16CHAR));
+	}
+
+	virtual int64 Tell() override
+	{
+		return Inner.Tell();
+	}
+
+	virtual FString GetArchiveName() const override
+	{
+		return Inner.GetArchiveName();
+	}
+
+private:
+	FArchive& Inner;
+};
+
+/** Snapshot taken on the game thread plus everything the worker produces from it. */
+struct FVolumeExtractionJob
+{
+	TArray<FVolumeRecord> Records;
+	FVolumeCaptureOptions Options;
+	bool bBinary = true;
+	FString Filename; // Empty = clipboard
+
+	// Filled by the worker
+	FString ClipboardText;
+	bool bSucceeded = false;
+	int64 NumBytes = 0;
+	double EncodeSeconds = 0.0;
+	TArray<double> RecordSeconds; // Geometry cleanup + JSON write per record
+	TArray<int64> RecordBytes;    // JSON only, the binary archive shares its pools across records
+
+	TFuture<void> Future;
+};
+
+static void WriteRecordsAsJson(FVolumeExtractionJob& Job, FArchive& Ar)
+{
+	// Records are written straight into the archive, no DOM is built
+	VolumeClipboardJson::TVolumeStreamWriter<> JsonWriter(&Ar);
+	for (int32 i = 0; i < Job.Records.Num(); i++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int64 StartBytes = JsonWriter.Tell();
+
+		JsonWriter.Write(Job.Records[i]);
+
+		Job.RecordSeconds[i] += FPlatformTime::Seconds() - StartTime;
+		Job.RecordBytes[i] = JsonWriter.Tell() - StartBytes;
+	}
+	JsonWriter.Close();
+}
+
+void FVolumeClipboardModule::EncodeExtraction(FVolumeExtractionJob& Job)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	const FVolumeCaptureOptions& Options = Job.Options;
+	TArray<FVolumeRecord>& Records = Job.Records;
+	TArray<double>& RecordSeconds = Job.RecordSeconds;
+	RecordSeconds.SetNumZeroed(Records.Num());
+	Job.RecordBytes.Init(INDEX_NONE, Records.Num());
+
+	ParallelFor(Records.Num(), [&Records, &RecordSeconds, &Options](int32 RecordIndex)
+	{
+		const double RecordStartTime = FPlatformTime::Seconds();
+		FinishCapturedGeometry(Options, Records[RecordIndex]);
+		RecordSeconds[RecordIndex] = FPlatformTime::Seconds() - RecordStartTime;
+	});
+
+	if (Job.Filename.IsEmpty())
+	{
+		if (Job.bBinary)
+		{
+			Job.ClipboardText = VolumeClipboardBinary::EncodeToText(Records);
+		}
+		else
+		{
+			TArray<uint8> JsonBytes;
+			FMemoryWriter JsonAr(JsonBytes);
+			WriteRecordsAsJson(Job, JsonAr);
+			Job.ClipboardText = VolumeClipboardJson::BytesToString(JsonBytes);
+		}
+		Job.NumBytes = Job.ClipboardText.Len() * sizeof(TCHAR);
+		Job.bSucceeded = true;
+	}
+	else
+	{
+		// IFileManager writers are safe to use off the game thread
+		TUniquePtr<FArchive> FileAr(IFileManager::Get().CreateFileWriter(*Job.Filename));
+		if (!FileAr)
+		{
+			UE_LOG(LogVolumeClipboard, Error, TEXT("Could not open '%s' for writing."), *Job.Filename);
+			return;
+		}
+
+		if (Job.bBinary)
+		{
+			VolumeClipboardBinary::Write(*FileAr, Records);
+		}
+		else
+		{
+			FileAr->Serialize((void*)JsonFileBom, sizeof(JsonFileBom));
+			FUtf16TextWriter TextAr(*FileAr);
+			WriteRecordsAsJson(Job, TextAr);
+		}
+		Job.NumBytes = FileAr->Tell();
+		Job.bSucceeded = FileAr->Close();
+	}
+
+	Job.EncodeSeconds = FPlatformTime::Seconds() - StartTime;
+}
+
+void FVolumeClipboardModule::CompleteExtraction(FVolumeExtractionJob& Job)
+{
+	const TCHAR* FormatName = Job.bBinary ? TEXT("binary") : TEXT("JSON");
+
+	double TotalSeconds = 0.0;
+	double SlowestSeconds = 0.0;
+	for (int32 i = 0; i < Job.Records.Num(); i++)
+	{
+		const double Elapsed = Job.RecordSeconds.IsValidIndex(i) ? Job.RecordSeconds[i] : 0.0;
+		TotalSeconds += Elapsed;
+		SlowestSeconds = FMath::Max(SlowestSeconds, Elapsed);
+
+		if (Job.RecordBytes.IsValidIndex(i) && Job.RecordBytes[i] != INDEX_NONE)
+		{
+			UE_LOG(LogVolumeClipboard, Verbose, TEXT("Extracted %s: %lld bytes in %.3f ms"), *Job.Records[i].InternalName, Job.RecordBytes[i], Elapsed * 1000.0);
+		}
+		else
+		{
+			UE_LOG(LogVolumeClipboard, Verbose, TEXT("Extracted %s in %.3f ms"), *Job.Records[i].InternalName, Elapsed * 1000.0);
+		}
+	}
+
+	const int32 NumVolumes = Job.Records.Num();
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Extracted %d volumes as %s: %lld bytes, %.2f ms total, %.3f ms per volume (slowest %.3f ms)"),
+		NumVolumes, FormatName, Job.NumBytes, TotalSeconds * 1000.0, NumVolumes > 0 ? TotalSeconds * 1000.0 / NumVolumes : 0.0, SlowestSeconds * 1000.0);
+
+	if (Job.Filename.IsEmpty())
+	{
+		FPlatformApplicationMisc::ClipboardCopy(*Job.ClipboardText);
+		UE_LOG(LogVolumeClipboard, Log, TEXT("Copied %d volumes as %s: %lld bytes, encoded in %.2f ms."), Job.Records.Num(), FormatName, Job.NumBytes, Job.EncodeSeconds * 1000.0);
+	}
+	else if (Job.bSucceeded)
+	{
+		UE_LOG(LogVolumeClipboard, Log, TEXT("Exported %d volumes to '%s' (%lld bytes, encoded in %.2f ms)."), Job.Records.Num(), *Job.Filename, Job.NumBytes, Job.EncodeSeconds * 1000.0);
+	}
+	else
+	{
+		UE_LOG(LogVolumeClipboard, Error, TEXT("Failed writing '%s'."), *Job.Filename);
+	}
+}
+
+bool FVolumeClipboardModule::TickPendingExtractions(float DeltaTime)
+{
+	// Finished in submission order, so a later copy never lands on the clipboard before an earlier one
+	while (PendingExtractions.Num() > 0 && PendingExtractions[0]->Future.IsReady())
+	{
+		TSharedPtr<FVolumeExtractionJob> Job = PendingExtractions[0];
+		PendingExtractions.RemoveAt(0);
+		CompleteExtraction(*Job);
+	}
+
+	if (PendingExtractions.Num() == 0)
+	{
+		ExtractionTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FVolumeClipboardModule::FlushPendingExtractions()
+{
+	// Unregister first, draining below only drops the handle
+	if (ExtractionTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(ExtractionTickerHandle);
+		ExtractionTickerHandle.Reset();
+	}
+
+	for (const TSharedPtr<FVolumeExtractionJob>& Job : PendingExtractions)
+	{
+		Job->Future.Wait();
+	}
+	TickPendingExtractions(0.0f);
+}
+
+bool FVolumeClipboardModule::ExtractVolumes(const TArray<AVolume*>& Volumes, bool bBinary, const FString& Filename)
+{
+	if (!GEditor) return false;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// ============================================================================================
+	// PHASE 1: SNAPSHOT (game thread)
+	// Everything that reads actors, reflection data or brush models is copied into plain records.
+	// ============================================================================================
+	const FVolumeCaptureContext Context(GEditor->GetEditorWorldContext().World());
+
+	TSharedPtr<FVolumeExtractionJob> Job = MakeShared<FVolumeExtractionJob>();
+	Job->Options = MakeCaptureOptions(bBinary);
+	Job->bBinary = bBinary;
+	Job->Filename = Filename;
+	Job->Records.SetNum(Volumes.Num());
+	for (int32 i = 0; i < Volumes.Num(); i++)
+	{
+		CaptureVolume(Volumes[i], Context, Job->Options, Job->Records[i]);
+	}
+
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Snapshot of %d volumes took %.2f ms on the game thread."), Volumes.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	// ============================================================================================
+	// PHASE 2: ENCODE (worker)
+	// Geometry cleanup, formatting and file writes only touch the records.
+	// ============================================================================================
+	if (!bBackgroundExtraction)
+	{
+		FlushPendingExtractions();
+		EncodeExtraction(*Job);
+		CompleteExtraction(*Job);
+		return Job->bSucceeded;
+	}
+
+	FVolumeExtractionJob* JobPtr = Job.Get();
+	Job->Future = Async(EAsyncExecution::ThreadPool, [JobPtr]() { EncodeExtraction(*JobPtr); });
+	PendingExtractions.Add(Job);
+
+	// ============================================================================================
+	// PHASE 3: OUTPUT (game thread)
+	// The clipboard is written from the core ticker once the worker is done.
+	// ============================================================================================
+	if (!ExtractionTickerHandle.IsValid())
+	{
+		ExtractionTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FVolumeClipboardModule::TickPendingExtractions));
+	}
+	return true;
+}
+
+FReply FVolumeClipboardModule::OnExtractVolumesClicked()
+{
+	TArray<AVolume*> Volumes;
+	GetSelectedVolumes(Volumes);
+
+	ExtractVolumes(Volumes, bUseBinaryFormat, FString());
+
+	return FReply::Handled();
+}
+
+FReply FVolumeClipboardModule::OnCreateVolumesClicked()
+{
+	// A copy that is still encoding has not reached the clipboard yet
+	FlushPendingExtractions();
+
+	FString ClipboardContent;
+	FPlatformApplicationMisc::ClipboardPaste(ClipboardContent);
+
+	if (ClipboardContent.IsEmpty()) return FReply::Handled();
+
+	// Format is detected from the content, so either mode can paste what the other copied
+	TArray<FVolumeRecord> Records;
+	bool bDecoded = false;
+	if (VolumeClipboardBinary::IsEncodedText(ClipboardContent))
+	{
+		bDecoded = VolumeClipboardBinary::DecodeFromText(ClipboardContent, Records);
+	}
+	else
+	{
+		bDecoded = VolumeClipboardJson::Decode(ClipboardContent, Records);
+	}
+
+	if (bDecoded)
+	{
+		PasteVolumeRecords(Records);
+	}
+	else
+	{
+		UE_LOG(LogVolumeClipboard, Warning, TEXT("Clipboard does not contain valid volume data."));
+	}
+
+	return FReply::Handled();
+}
+
+// ---------------------------------------------------------
+// LOGIC: File Transport
+// ---------------------------------------------------------
+
+static const TCHAR* VolumeFileTypes = TEXT("Volume Archive (*.vclb)|*.vclb|Volume JSON (*.json)|*.json");
+
+static bool DecodeVolumeFile(const uint8* Data, int64 Size, TArray<FVolumeRecord>& OutRecords)
+{
+	FBufferReader Reader((void*)Data, Size, false);
+
+	uint32 Magic = 0;
+	if (Size >= (int64)sizeof(Magic))
+	{
+		FMemory::Memcpy(&Magic, Data, sizeof(Magic));
+	}
+
+	if (Magic == VolumeClipboardBinary::Magic)
+	{
+		return VolumeClipboardBinary::Read(Reader, OutRecords);
+	}
+
+	// In place only where TCHAR is UTF-16, BufferToString below converts UTF-16 files everywhere else
+	if (sizeof(TCHAR) == sizeof(UTF16CHAR) && Size >= 2 && Data[0] == JsonFileBom[0] && Data[1] == JsonFileBom[1])
+	{
+		Reader.Seek(2);
+		return VolumeClipboardJson::DecodeStream<TCHAR>(Reader, OutRecords);
+	}
+
+	// UTF-8 / ANSI / UTF-16 JSON from other tools, or saved clipboard text: convert once and decode
+	FString Text;
+	FFileHelper::BufferToString(Text, Data, (int32)Size);
+	if (VolumeClipboardBinary::IsEncodedText(Text))
+	{
+		return VolumeClipboardBinary::DecodeFromText(Text, OutRecords);
+	}
+	return VolumeClipboardJson::Decode(Text, OutRecords);
+}
+
+bool FVolumeClipboardModule::ExportSelectedVolumesToFile(const FString& Filename)
+{
+	TArray<AVolume*> Volumes;
+	GetSelectedVolumes(Volumes);
+
+	const bool bWriteJson = FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	return ExtractVolumes(Volumes, !bWriteJson, Filename);
+}
+
+bool FVolumeClipboardModule::ExportWorldVolumesToDirectory(const FString& Directory, const FVolumeWorldFilter& Filter)
+{
+	if (!GEditor) return false;
+
+	TArray<FLevelVolumes> Levels;
+	if (!GatherWorldVolumes(GEditor->GetEditorWorldContext().World(), Filter, Levels)) return false;
+
+	const TCHAR* Extension = bUseBinaryFormat ? TEXT(".vclb") : TEXT(".json");
+	TSet<FString> UsedNames;
+
+	// One snapshot + file per level, so huge worlds are never held as a single payload
+	for (const FLevelVolumes& Entry : Levels)
+	{
+		const FString BaseName = FPaths::MakeValidFileName(FPackageName::GetShortName(Entry.Level->GetOutermost()->GetName()));
+
+		// Sub-levels in different folders can share a short name
+		FString FileName = BaseName;
+		for (int32 Suffix = 2; UsedNames.Contains(FileName); Suffix++)
+		{
+			FileName = FString::Printf(TEXT("%s_%d"), *BaseName, Suffix);
+		}
+		UsedNames.Add(FileName);
+
+		ExtractVolumes(Entry.Volumes, bUseBinaryFormat, FPaths::Combine(Directory, FileName + Extension));
+	}
+
+	UE_LOG(LogVolumeClipboard, Log, TEXT("World export: %d level files queued in '%s'."), Levels.Num(), *Directory);
+	return true;
+}
+
+bool FVolumeClipboardModule::ImportVolumesFromFile(const FString& Filename)
+{
+	FlushPendingExtractions();
+
+	TArray<FVolumeRecord> Records;
+	bool bDecoded = false;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*Filename));
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile ? MappedFile->MapRegion(0, MappedFile->GetFileSize()) : nullptr);
+
+	if (MappedRegion)
+	{
+		// Parse the mapped pages in place, the file is never copied into one contiguous buffer or string
+		bDecoded = DecodeVolumeFile(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), Records);
+	}
+	else
+	{
+		// Mapping is not available on every platform / file system
+		TArray<uint8> Bytes;
+		if (FFileHelper::LoadFileToArray(Bytes, *Filename))
+		{
+			bDecoded = DecodeVolumeFile(Bytes.GetData(), Bytes.Num(), Records);
+		}
+	}
+
+	if (!bDecoded)
+	{
+		UE_LOG(LogVolumeClipboard, Warning, TEXT("'%s' does not contain valid volume data."), *Filename);
+		return false;
+	}
+
+	PasteVolumeRecords(Records);
+	return true;
+}
+
+FReply FVolumeClipboardModule::OnExportToFileClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform) return FReply::Handled();
+
+	TArray<FString> OutFiles;
+	const void* ParentWindowHandle = FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr);
+
+	if (DesktopPlatform->SaveFileDialog(ParentWindowHandle, LOCTEXT("ExportDialogTitle", "Export Volumes").ToString(), FPaths::ProjectSavedDir(), TEXT("Volumes.vclb"), VolumeFileTypes, EFileDialogFlags::None, OutFiles) && OutFiles.Num() > 0)
+	{
+		ExportSelectedVolumesToFile(OutFiles[0]);
+	}
+
+	return FReply::Handled();
+}
+
+FReply FVolumeClipboardModule::OnImportFromFileClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform) return FReply::Handled();
+
+	TArray<FString> OutFiles;
+	const void* ParentWindowHandle = FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr);
+
+	if (DesktopPlatform->OpenFileDialog(ParentWindowHandle, LOCTEXT("ImportDialogTitle", "Import Volumes").ToString(), FPaths::ProjectSavedDir(), TEXT(""), VolumeFileTypes, EFileDialogFlags::None, OutFiles) && OutFiles.Num() > 0)
+	{
+		ImportVolumesFromFile(OutFiles[0]);
+	}
+
+	return FReply::Handled();
+}
+
+FReply FVolumeClipboardModule::OnExportWorldClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform) return FReply::Handled();
+
+	FString Directory;
+	const void* ParentWindowHandle = FSlateApplication::Get().FindBestParentWindowHandleForDialogs(nullptr);
+
+	if (DesktopPlatform->OpenDirectoryDialog(ParentWindowHandle, LOCTEXT("ExportWorldDialogTitle", "Export Level Volumes").ToString(), FPaths::ProjectSavedDir(), Directory))
+	{
+		ExportWorldVolumesToDirectory(Directory, MakeWorldFilter());
+	}
+
+	return FReply::Handled();
+}
+
+static bool ParseVectorArg(const FString& Text, FVector& OutVector)
 {
-	return FString::Printf(TEXT("%.17g"), Val);
+	TArray<FString> Parts;
+	if (Text.ParseIntoArray(Parts, TEXT(",")) != 3) return false;
+
+	OutVector = FVector(FCString::Atof(*Parts[0]), FCString::Atof(*Parts[1]), FCString::Atof(*Parts[2]));
+	return true;
+}
+
+void FVolumeClipboardModule::ExportWorldCommand(const TArray<FString>& Args)
+{
+	FVolumeWorldFilter Filter;
+	FString Directory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("VolumeExport"));
+	FVector Min, Max;
+	bool bHasMin = false;
+	bool bHasMax = false;
+
+	for (const FString& Arg : Args)
+	{
+		FString Value;
+		if (FParse::Value(*Arg, TEXT("Class="), Value))
+		{
+			Filter.ClassName = Value;
+		}
+		else if (FParse::Value(*Arg, TEXT("Name="), Value))
+		{
+			Filter.NamePattern = Value;
+		}
+		else if (FParse::Value(*Arg, TEXT("Levels="), Value, false))
+		{
+			Value.ParseIntoArray(Filter.Levels, TEXT(","));
+			for (FString& Level : Filter.Levels)
+			{
+				Level.TrimStartAndEndInline();
+			}
+			Filter.Levels.RemoveAll([](const FString& Level) { return Level.IsEmpty(); });
+		}
+		else if (FParse::Value(*Arg, TEXT("Min="), Value, false))
+		{
+			bHasMin = ParseVectorArg(Value, Min);
+		}
+		else if (FParse::Value(*Arg, TEXT("Max="), Value, false))
+		{
+			bHasMax = ParseVectorArg(Value, Max);
+		}
+		else if (!Arg.Contains(TEXT("=")))
+		{
+			Directory = Arg;
+		}
+		else
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("VolumeClipboard.ExportWorld: unknown argument '%s'."), *Arg);
+		}
+	}
+
+	if (bHasMin != bHasMax)
+	{
+		UE_LOG(LogVolumeClipboard, Warning, TEXT("VolumeClipboard.ExportWorld: Min and Max must be given together (X,Y,Z)."));
+		return;
+	}
+	if (bHasMin)
+	{
+		Filter.Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+	}
+
+	ExportWorldVolumesToDirectory(Directory, Filter);
+}
+
+// ---------------------------------------------------------
+// LOGIC: BSP Benchmark
+// ---------------------------------------------------------
+void FVolumeClipboardModule::BenchmarkBspBuild()
+{
+	if (!GEditor) return;
+
+	TArray<AVolume*> Volumes;
+	GetSelectedVolumes(Volumes);
+
+	const FVolumeCaptureContext Context(GEditor->GetEditorWorldContext().World());
+	const FVolumeCaptureOptions Options = MakeCaptureOptions(true);
+
+	// Goes through capture + record decode like a real copy/paste, so cooked (BSP node only) volumes work too
+	auto MakeScratchModel = [](const TArray<FPoly>& Polys)
+	{
+		UModel* Model = NewObject<UModel>(GetTransientPackage(), NAME_None, RF_Transient);
+		Model->Initialize(nullptr, true);
+		Model->Polys = NewObject<UPolys>(Model, NAME_None, RF_Transient);
+		for (const FPoly& Poly : Polys)
+		{
+			Model->Polys->Element.Add(Poly);
+		}
+		return Model;
+	};
+
+	double OldSeconds = 0.0;
+	double NewSeconds = 0.0;
+	int32 NumConvex = 0;
+	int32 OldNodes = 0;
+	int32 NewNodes = 0;
+
+	for (AVolume* Volume : Volumes)
+	{
+		FVolumeRecord Rec;
+		CaptureVolume(Volume, Context, Options, Rec);
+		FinishCapturedGeometry(Options, Rec);
+
+		TArray<FPoly> Polys;
+		VolumeClipboardGeometry::BuildPolys(Rec, Polys);
+		if (Polys.Num() == 0) continue;
+
+		const bool bConvex = VolumeClipboardGeometry::IsConvex(Polys);
+		if (bConvex) NumConvex++;
+
+		// Old paste path: bspBuild(BSP_Optimal), then csgPrepMovingBrush (which rebuilds with BSP_Good)
+		UModel* OldModel = MakeScratchModel(Polys);
+		double StartTime = FPlatformTime::Seconds();
+		FBSPOps::bspBuild(OldModel, FBSPOps::BSP_Optimal, 15, 70, 1, 0);
+		VolumeClipboardBrush::BuildBrushBsp(OldModel, false, FBSPOps::BSP_Good);
+		OldSeconds += FPlatformTime::Seconds() - StartTime;
+		OldNodes += OldModel->Nodes.Num();
+
+		UModel* NewModel = MakeScratchModel(Polys);
+		StartTime = FPlatformTime::Seconds();
+		VolumeClipboardBrush::BuildBrushBsp(NewModel, bConvex, (FBSPOps::EBspOptimization)BspQuality);
+		NewSeconds += FPlatformTime::Seconds() - StartTime;
+		NewNodes += NewModel->Nodes.Num();
+	}
+
+	UE_LOG(LogVolumeClipboard, Display, TEXT("BSP benchmark on %d volumes (%d convex): old %.2f ms (%d nodes), new %.2f ms (%d nodes), %.1fx"),
+		Volumes.Num(), NumConvex, OldSeconds * 1000.0, OldNodes, NewSeconds * 1000.0, NewNodes, NewSeconds > 0.0 ? OldSeconds / NewSeconds : 0.0);
+}
+
+// ---------------------------------------------------------
+// HELPER: Target Level Lookup
+// ---------------------------------------------------------
+struct FLevelLookup
+{
+	// Same precedence as a scan of World->GetLevels(): full package name first, then short name, first level wins
+	TMap<FString, ULevel*> ByPackage;
+	TMap<FString, ULevel*> ByShortName;
+
+	void Build(UWorld* World)
+	{
+		ByPackage.Reset();
+		ByShortName.Reset();
+
+		for (ULevel* Level : World->GetLevels())
+		{
+			if (!Level) continue;
+
+			const FString PackageName = Level->GetOutermost()->GetName();
+			const FString ShortName = FPackageName::GetShortName(PackageName);
+			if (!ByPackage.Contains(PackageName)) ByPackage.Add(PackageName, Level);
+			if (!ByShortName.Contains(ShortName)) ByShortName.Add(ShortName, Level);
+		}
+	}
+
+	ULevel* Find(const FString& PackageName, const FString& ShortName) const
+	{
+		if (!PackageName.IsEmpty())
+		{
+			if (ULevel* const* Level = ByPackage.Find(PackageName)) return *Level;
+		}
+		ULevel* const* Level = ByShortName.Find(ShortName);
+		return Level ? *Level : nullptr;
+	}
+};
+
+// ---------------------------------------------------------
+// HELPER: Streaming Level Index
+// ---------------------------------------------------------
+struct FStreamingLevelIndex
+{
+	// A required path matches every streaming level with the same package or the same short name
+	TMap<FString, TArray<ULevelStreaming*, TInlineAllocator<1>>> ByPackage;
+	TMap<FString, TArray<ULevelStreaming*, TInlineAllocator<1>>> ByShortName;
+
+	void Build(UWorld* World)
+	{
+		ByPackage.Reset();
+		ByShortName.Reset();
+
+		for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			if (!StreamingLevel) continue;
+
+			const FString PackageName = StreamingLevel->GetWorldAssetPackageName();
+			ByPackage.FindOrAdd(PackageName).Add(StreamingLevel);
+			ByShortName.FindOrAdd(FPackageName::GetShortName(PackageName)).Add(StreamingLevel);
+		}
+	}
+
+	template <typename FunctorType>
+	void ForEachMatch(const FString& Path, FunctorType&& Functor) const
+	{
+		if (const auto* Levels = ByPackage.Find(Path))
+		{
+			for (ULevelStreaming* StreamingLevel : *Levels) Functor(StreamingLevel);
+		}
+		if (const auto* Levels = ByShortName.Find(FPackageName::GetShortName(Path)))
+		{
+			for (ULevelStreaming* StreamingLevel : *Levels) Functor(StreamingLevel);
+		}
+	}
+};
+
+// ---------------------------------------------------------
+// HELPER: Quiet Actor Label
+// SetActorLabel does Modify, PostEditChange and a label broadcast per call.
+// Bulk paste writes the property directly, the outliner reads labels on display.
+// ---------------------------------------------------------
+static void SetActorLabelQuiet(AActor* Actor, const FString& Label)
+{
+	static FStrProperty* LabelProperty = FindFProperty<FStrProperty>(AActor::StaticClass(), TEXT("ActorLabel"));
+	if (LabelProperty)
+	{
+		LabelProperty->SetPropertyValue_InContainer(Actor, Label);
+	}
+	else
+	{
+		Actor->SetActorLabel(Label, false);
+	}
+}
+
+// ---------------------------------------------------------
+// HELPER: Undo Buffer Size
+// ---------------------------------------------------------
+static SIZE_T GetUndoBufferSize()
+{
+	SIZE_T Size = 0;
+	if (GEditor && GEditor->Trans)
+	{
+		for (int32 QueueIndex = 0; QueueIndex < GEditor->Trans->GetQueueLength(); QueueIndex++)
+		{
+			if (const FTransaction* Transaction = GEditor->Trans->GetTransaction(QueueIndex))
+			{
+				Size += Transaction->DataSize();
+			}
+		}
+	}
+	return Size;
 }
 
-// ---------------------------------------------------------
-// LOGIC: Serialization / Extraction
-// ---------------------------------------------------------
+// ---------------------------------------------------------
+// HELPER: Batched Sub-Level Loading
+// ---------------------------------------------------------
+static void AddLevelsToWorldBatched(UWorld* World, const TArray<FString>& LevelPaths)
+{
+	struct FLevelLoadTiming
+	{
+		double RequestTime = 0.0;
+		double LoadSeconds = -1.0;
+		double AttachSeconds = 0.0;
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FLevelLoadTiming> Timings;
+	Timings.SetNum(LevelPaths.Num());
+
+	// 1. Issue every package load at once, the async loader works through them in parallel with its own IO
+	for (int32 i = 0; i < LevelPaths.Num(); i++)
+	{
+		FLevelLoadTiming& Timing = Timings[i];
+		Timing.RequestTime = FPlatformTime::Seconds();
+		LoadPackageAsync(LevelPaths[i], FLoadPackageAsyncDelegate::CreateLambda([&Timing](const FName&, UPackage*, EAsyncLoadingResult::Type Result)
+		{
+			if (Result == EAsyncLoadingResult::Succeeded)
+			{
+				Timing.LoadSeconds = FPlatformTime::Seconds() - Timing.RequestTime;
+			}
+		}));
+	}
+
+	// Blocks until all requests above have completed (and fired their callbacks)
+	FlushAsyncLoading();
+	const double LoadedTime = FPlatformTime::Seconds();
+
+	// 2. Attach, the packages are in memory now so this is only streaming-level bookkeeping
+	GEditor->SelectNone(true, true);
+	GEditor->NoteSelectionChange();
+
+	int32 NumAttached = 0;
+	for (int32 i = 0; i < LevelPaths.Num(); i++)
+	{
+		const double AttachStart = FPlatformTime::Seconds();
+		auto NewLevel = UEditorLevelUtils::AddLevelToWorld(World, *LevelPaths[i], ULevelStreamingDynamic::StaticClass());
+
+		// AddLevelToWorld makes the new level current, the next add must not nest inside it
+		if (World->PersistentLevel)
+		{
+			World->SetCurrentLevel(World->PersistentLevel);
+		}
+
+		Timings[i].AttachSeconds = FPlatformTime::Seconds() - AttachStart;
+		if (NewLevel) NumAttached++;
+	}
+
+	// 3. One streaming flush for all of them
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Visibility);
+
+	for (int32 i = 0; i < LevelPaths.Num(); i++)
+	{
+		const FLevelLoadTiming& Timing = Timings[i];
+		if (Timing.LoadSeconds < 0.0)
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("Level %s: async load failed, attach took %.2f ms"), *LevelPaths[i], Timing.AttachSeconds * 1000.0);
+		}
+		else
+		{
+			UE_LOG(LogVolumeClipboard, Log, TEXT("Level %s: loaded in %.2f ms, attached in %.2f ms"), *LevelPaths[i], Timing.LoadSeconds * 1000.0, Timing.AttachSeconds * 1000.0);
+		}
+	}
+
+	const double EndTime = FPlatformTime::Seconds();
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Added %d / %d sub-levels in %.2f ms (loads %.2f ms, attach + flush %.2f ms)"),
+		NumAttached, LevelPaths.Num(), (EndTime - StartTime) * 1000.0, (LoadedTime - StartTime) * 1000.0, (EndTime - LoadedTime) * 1000.0);
+}
 
-void FVolumeClipboardModule::SerializeObjectProperties(UObject* Obj, TSharedPtr<FJsonObject>& OutJson)
+void FVolumeClipboardModule::ResolveVolumeClasses(const TArray<FVolumeRecord>& Records, TMap<FString, UClass*>& OutClasses)
 {
-	for (TFieldIterator<FProperty> PropIt(Obj->GetClass()); PropIt; ++PropIt)
-	{
-		FProperty* Property = *PropIt;
-		if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient)) continue;
-		if (!IsPropertySafeToCopy(Property, Obj)) continue;
+	const double StartTime = FPlatformTime::Seconds();
 
-		FString StringValue;
-		Property->ExportTextItem(StringValue, Property->ContainerPtrToValuePtr<void>(Obj), nullptr, Obj, PPF_None);
+	// Classes already in memory (native and open blueprints) resolve without touching the disk
+	TArray<FString> PendingPaths;
+	TArray<FSoftObjectPath> PendingLoads;
+	for (const FVolumeRecord& Rec : Records)
+	{
+		if (OutClasses.Contains(Rec.Class)) continue;
 
-		if (!StringValue.IsEmpty() && StringValue != "None" && StringValue != "()" && StringValue != "nullptr")
+		UClass* Class = FindObject<UClass>(nullptr, *Rec.Class);
+		OutClasses.Add(Rec.Class, Class);
+		if (!Class && !Rec.Class.IsEmpty())
 		{
-			OutJson->SetStringField(Property->GetName(), StringValue);
+			PendingPaths.Add(Rec.Class);
+			PendingLoads.Emplace(Rec.Class);
 		}
 	}
-}
 
-void FVolumeClipboardModule::RestoreObjectProperties(UObject* Obj, const TSharedPtr<FJsonObject>& InJson)
-{
-	for (auto& Pair : InJson->Values)
+	// Everything else (blueprint volume classes) is requested as one async batch, then waited on once
+	if (PendingLoads.Num() > 0)
 	{
-		FString PropName = Pair.Key;
-		FString PropValString = Pair.Value->AsString();
-		FProperty* Property = Obj->GetClass()->FindPropertyByName(*PropName);
+		TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(PendingLoads, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		if (Handle.IsValid())
+		{
+			Handle->WaitUntilComplete();
+		}
 
-		if (Property && IsPropertySafeToCopy(Property, Obj))
+		for (int32 i = 0; i < PendingLoads.Num(); i++)
 		{
-			Property->ImportText(*PropValString, Property->ContainerPtrToValuePtr<void>(Obj), 0, Obj);
+			UClass* Class = Cast<UClass>(PendingLoads[i].ResolveObject());
+			if (!Class)
+			{
+				// Paths the streamer could not handle (e.g. redirected packages) fall back to a synchronous load here, not mid-spawn
+				Class = LoadObject<UClass>(nullptr, *PendingPaths[i]);
+			}
+			OutClasses.Add(PendingPaths[i], Class);
 		}
 	}
+
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Resolved %d volume classes (%d loaded from disk) in %.2f ms"), OutClasses.Num(), PendingLoads.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
-FReply FVolumeClipboardModule::OnExtractVolumesClicked()
+void FVolumeClipboardModule::PasteVolumeRecords(const TArray<FVolumeRecord>& Records)
 {
-	TArray<TSharedPtr<FJsonValue>> VolumeArray;
-	if (!GEditor) return FReply::Handled();
+	if (!GEditor) return;
 
 	UWorld* World = GEditor->GetEditorWorldContext().World();
+	if (!World) return;
 
-	USelection* SelectedActors = GEditor->GetSelectedActors();
-	for (FSelectionIterator It(*SelectedActors); It; ++It)
-	{
-		AActor* Actor = Cast<AActor>(*It);
-		AVolume* Volume = Cast<AVolume>(Actor);
-
-		if (Volume)
-		{
-			TSharedPtr<FJsonObject> VolObj = MakeShareable(new FJsonObject);
-
-			VolObj->SetStringField("Class", Volume->GetClass()->GetPathName());
-			VolObj->SetStringField("InternalName", Volume->GetName());
+	// Save current level so we can restore it ONCE at the end
+	ULevel* SavedCurrentLevel = World->GetCurrentLevel();
 
-			if (Volume->GetLevel())
-			{
-				UPackage* LevelPackage = Volume->GetLevel()->GetOutermost();
-				FString LevelPackageName = LevelPackage->GetName();
-				FString LevelShortName = FPackageName::GetShortName(LevelPackageName);
+	// =========================================================================================
+	// PHASE 1: SCAN FOR REQUIRED LEVELS & LOAD THEM IMMEDIATELY
+	// =========================================================================================
+	TSet<FString> RequiredLevelPaths;
+	TArray<FString> MissingLevelPaths;
+	EAppReturnType::Type MissingLevelResponse = EAppReturnType::Retry;
 
-				VolObj->SetStringField("OriginLevel", LevelShortName);
-				VolObj->SetStringField("OriginLevelPackage", LevelPackageName);
-			}
+	// 1. Collect all potential level paths (light pre-scan of the decoded records, only StreamingLevelNames is read)
+	for (const FVolumeRecord& Rec : Records)
+	{
+		if (const FVolumePropertyRecord* LevelNamesProp = Rec.FindProperty(TEXT("StreamingLevelNames")))
+		{
+			FString RawNames = LevelNamesProp->Value;
+			RawNames = RawNames.Replace(TEXT("("), TEXT("")).Replace(TEXT(")"), TEXT("")).Replace(TEXT("\""), TEXT("")).Replace(TEXT("\'"), TEXT(""));
 
-			if (World && Cast<ALevelStreamingVolume>(Volume))
+			TArray<FString> Targets;
+			RawNames.ParseIntoArray(Targets, TEXT(","), true);
+			for (FString& Path : Targets)
 			{
-				TArray<TSharedPtr<FJsonValue>> StreamLinks;
-				for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+				FString CleanPath = Path.TrimStartAndEnd();
+				if (!CleanPath.IsEmpty())
 				{
-					if (StreamingLevel)
-					{
-						int32 SlotIndex = StreamingLevel->EditorStreamingVolumes.Find(Cast<ALevelStreamingVolume>(Volume));
-						if (SlotIndex != INDEX_NONE)
-						{
-							TSharedPtr<FJsonObject> LinkObj = MakeShareable(new FJsonObject);
-							LinkObj->SetStringField("Package", StreamingLevel->GetWorldAssetPackageName());
-							LinkObj->SetNumberField("Slot", SlotIndex);
-							StreamLinks.Add(MakeShareable(new FJsonValueObject(LinkObj)));
-						}
-					}
+					RequiredLevelPaths.Add(CleanPath);
 				}
-				VolObj->SetArrayField("StreamLinks", StreamLinks);
 			}
+		}
+	}
 
-			FVector CenterLocation = Volume->GetActorLocation();
-			VolObj->SetStringField("LocX", DoubleToPrecisionString(CenterLocation.X));
-			VolObj->SetStringField("LocY", DoubleToPrecisionString(CenterLocation.Y));
-			VolObj->SetStringField("LocZ", DoubleToPrecisionString(CenterLocation.Z));
+	// 2. Iterate and Load Levels
+	FString CurrentWorldPkg = World->GetOutermost()->GetName();
+	FString CurrentWorldShort = FPackageName::GetShortName(CurrentWorldPkg);
 
-			FQuat Quat = Volume->GetActorQuat();
-			VolObj->SetStringField("QuatX", DoubleToPrecisionString(Quat.X));
-			VolObj->SetStringField("QuatY", DoubleToPrecisionString(Quat.Y));
-			VolObj->SetStringField("QuatZ", DoubleToPrecisionString(Quat.Z));
-			VolObj->SetStringField("QuatW", DoubleToPrecisionString(Quat.W));
+	for (const FString& PathToCheck : RequiredLevelPaths)
+	{
+		// Check if Package Exists (Prevent crash on invalid path)
+		if (!FPackageName::DoesPackageExist(PathToCheck)) continue;
 
-			FVector Scale = Volume->GetActorScale3D();
-			VolObj->SetStringField("SclX", DoubleToPrecisionString(Scale.X));
-			VolObj->SetStringField("SclY", DoubleToPrecisionString(Scale.Y));
-			VolObj->SetStringField("SclZ", DoubleToPrecisionString(Scale.Z));
+		// Safety: Don't load self (Recursion Crash Fix)
+		FString CheckShort = FPackageName::GetShortName(PathToCheck);
+		if (PathToCheck == CurrentWorldPkg || CheckShort == CurrentWorldShort) continue;
 
-			VolObj->SetNumberField("SpawnMethod", (int32)Volume->SpawnCollisionHandlingMethod);
-			if (Volume->GetRootComponent())
+		// Check if already loaded
+		bool bIsLoaded = false;
+		for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			if (StreamingLevel && (StreamingLevel->GetWorldAssetPackageName() == PathToCheck || FPackageName::GetShortName(StreamingLevel->GetWorldAssetPackageName()) == CheckShort))
 			{
-				VolObj->SetNumberField("Mobility", (int32)Volume->GetRootComponent()->Mobility);
+				bIsLoaded = true;
+				break;
 			}
-			VolObj->SetNumberField("BrushType", (int32)Volume->BrushType);
+		}
 
-			TSharedPtr<FJsonObject> ActorProps = MakeShareable(new FJsonObject);
-			SerializeObjectProperties(Volume, ActorProps);
-			VolObj->SetObjectField("Properties", ActorProps);
+		if (bIsLoaded) continue;
 
-			TArray<TSharedPtr<FJsonValue>> ComponentList;
-			for (UActorComponent* Comp : Volume->GetComponents())
-			{
-				if (Comp->IsA(UBrushComponent::StaticClass())) continue;
+		// Batch mode confirms and loads everything together after the scan
+		if (bBatchLevelLoading)
+		{
+			MissingLevelPaths.Add(PathToCheck);
+			continue;
+		}
 
-				TSharedPtr<FJsonObject> CompObj = MakeShareable(new FJsonObject);
-				CompObj->SetStringField("ClassName", Comp->GetClass()->GetName());
+		// Check User Preference
+		if (MissingLevelResponse == EAppReturnType::NoAll) continue;
 
-				TSharedPtr<FJsonObject> CompProps = MakeShareable(new FJsonObject);
-				SerializeObjectProperties(Comp, CompProps);
+		bool bShouldLoad = false;
+		if (MissingLevelResponse == EAppReturnType::YesAll)
+		{
+			bShouldLoad = true;
+		}
+		else
+		{
+			FText Message = FText::Format(LOCTEXT("MissingLevelPrompt", "The Level '{0}' referenced by this volume is not in the current world.\n\nDo you want to add it as a Sub-Level now?"), FText::FromString(CheckShort));
+			MissingLevelResponse = FMessageDialog::Open(EAppMsgType::YesNoYesAllNoAll, Message);
 
-				CompObj->SetObjectField("Props", CompProps);
-				ComponentList.Add(MakeShareable(new FJsonValueObject(CompObj)));
+			if (MissingLevelResponse == EAppReturnType::Yes || MissingLevelResponse == EAppReturnType::YesAll)
+			{
+				bShouldLoad = true;
 			}
-			VolObj->SetArrayField("Components", ComponentList);
-
-			UModel* Model = Volume->Brush;
-			if (!Model && Volume->GetBrushComponent()) Model = Volume->GetBrushComponent()->Brush;
+		}
 
-			if (Model)
+		if (bShouldLoad)
+		{
+			// CRITICAL FIX: Ensure no actors are selected in the new map, which prevents state corruption during context switches
+			GEditor->SelectNone(true, true);
+			GEditor->NoteSelectionChange();
+
+			// LOAD LEVEL
+			// FIX: Use 'auto' to handle the return type safely.
+			// In UE4.27 this returns ULevel*, but if your build expects ULevelStreaming*, auto handles the assignment.
+			auto NewLevel = UEditorLevelUtils::AddLevelToWorld(World, *PathToCheck, ULevelStreamingDynamic::StaticClass());
+
+			// CRITICAL FIX: FORCE RESET to Persistent Level immediately inside the loop.
+			// AddLevelToWorld automatically sets the new level as "Current".
+			// Failing to reset this causes the NEXT AddLevelToWorld call to try adding a sublevel-to-a-sublevel, which crashes on the 2nd attempt.
+			if (World->PersistentLevel)
 			{
-				TArray<TSharedPtr<FJsonValue>> PolyArray;
-
-				if (Model->Polys && Model->Polys->Element.Num() > 0)
-				{
-					for (const FPoly& Poly : Model->Polys->Element)
-					{
-						TSharedPtr<FJsonObject> PolyObj = MakeShareable(new FJsonObject);
-						TArray<TSharedPtr<FJsonValue>> VertArray;
-
-						PolyObj->SetNumberField("Flags", (double)Poly.PolyFlags);
-
-						for (const FVector& V : Poly.Vertices)
-						{
-							TSharedPtr<FJsonObject> VObj = MakeShareable(new FJsonObject);
-							VObj->SetNumberField("X", V.X);
-							VObj->SetNumberField("Y", V.Y);
-							VObj->SetNumberField("Z", V.Z);
-							VertArray.Add(MakeShareable(new FJsonValueObject(VObj)));
-						}
-						PolyObj->SetArrayField("Verts", VertArray);
-						PolyArray.Add(MakeShareable(new FJsonValueObject(PolyObj)));
-					}
-				}
-				else if (Model->Nodes.Num() > 0)
-				{
-					for (int32 i = 0; i < Model->Nodes.Num(); i++)
-					{
-						const FBspNode& Node = Model->Nodes[i];
-						if (Node.NumVertices < 3) continue;
-
-						TSharedPtr<FJsonObject> PolyObj = MakeShareable(new FJsonObject);
-						TArray<TSharedPtr<FJsonValue>> VertArray;
-
-						PolyObj->SetNumberField("Flags", (double)Node.NodeFlags);
-
-						for (int32 v = 0; v < Node.NumVertices; v++)
-						{
-							int32 VertIndex = Model->Verts[Node.iVertPool + v].pVertex;
-							const FVector& V = Model->Points[VertIndex];
-
-							TSharedPtr<FJsonObject> VObj = MakeShareable(new FJsonObject);
-							VObj->SetNumberField("X", V.X);
-							VObj->SetNumberField("Y", V.Y);
-							VObj->SetNumberField("Z", V.Z);
-							VertArray.Add(MakeShareable(new FJsonValueObject(VObj)));
-						}
-						PolyObj->SetArrayField("Verts", VertArray);
-						PolyArray.Add(MakeShareable(new FJsonValueObject(PolyObj)));
-					}
-				}
-				VolObj->SetArrayField("RawPolys", PolyArray);
+				World->SetCurrentLevel(World->PersistentLevel);
 			}
 
-			VolObj->SetStringField("BuilderType", "CustomPolys");
-			VolumeArray.Add(MakeShareable(new FJsonValueObject(VolObj)));
+			// Flush streaming state to ensure memory is stable before next iteration
+			if (NewLevel)
+			{
+				World->FlushLevelStreaming(EFlushLevelStreamingType::Visibility);
+			}
 		}
 	}
 
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(VolumeArray, Writer);
-	FPlatformApplicationMisc::ClipboardCopy(*OutputString);
-
-	return FReply::Handled();
-}
-
-FReply FVolumeClipboardModule::OnCreateVolumesClicked()
-{
-	FString ClipboardContent;
-	FPlatformApplicationMisc::ClipboardPaste(ClipboardContent);
-
-	if (ClipboardContent.IsEmpty()) return FReply::Handled();
+	if (MissingLevelPaths.Num() > 0)
+	{
+		FString LevelList;
+		for (const FString& Path : MissingLevelPaths)
+		{
+			LevelList += FPackageName::GetShortName(Path) + TEXT("\n");
+		}
 
-	TArray<TSharedPtr<FJsonValue>> JsonArray;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ClipboardContent);
+		FText Message = FText::Format(LOCTEXT("MissingLevelsBatchPrompt", "{0} levels referenced by these volumes are not in the current world:\n\n{1}\nDo you want to add them as Sub-Levels now?"), FText::AsNumber(MissingLevelPaths.Num()), FText::FromString(LevelList));
+		if (FMessageDialog::Open(EAppMsgType::YesNo, Message) == EAppReturnType::Yes)
+		{
+			AddLevelsToWorldBatched(World, MissingLevelPaths);
+		}
+	}
 
-	if (FJsonSerializer::Deserialize(Reader, JsonArray))
+	// Everything after the level prompts runs under a progress dialog: class resolve, poly prep, one frame per volume, finalize, relink
+	FScopedSlowTask SlowTask(Records.Num() + 4, LOCTEXT("PasteVolumesProgress", "Pasting Volumes"));
+	SlowTask.MakeDialog(true);
+	const double PasteStart = FPlatformTime::Seconds();
+
+	// Built after the loads above, so levels added in Phase 1 are included
+	FLevelLookup LevelLookup;
+	LevelLookup.Build(World);
+
+	// 3. Resolve every distinct volume class up front, so the spawn loop below only does map lookups
+	SlowTask.EnterProgressFrame(1, LOCTEXT("PasteResolveClasses", "Resolving volume classes"));
+	TMap<FString, UClass*> VolumeClasses;
+	ResolveVolumeClasses(Records, VolumeClasses);
+
+	// 4. Build brush polys for every record on worker threads, nothing in there depends on UObject state
+	SlowTask.EnterProgressFrame(1, LOCTEXT("PastePreparePolys", "Building brush polys"));
+	const double PrepStart = FPlatformTime::Seconds();
+	TArray<TArray<FPoly>> PreparedPolys;
+	TArray<bool> PreparedConvex;
+	TArray<uint32> PreparedHashes;
+	PreparedPolys.SetNum(Records.Num());
+	PreparedConvex.SetNumZeroed(Records.Num());
+	PreparedHashes.SetNumZeroed(Records.Num());
+	ParallelFor(Records.Num(), [&Records, &PreparedPolys, &PreparedConvex, &PreparedHashes](int32 RecordIndex)
 	{
-		UWorld* World = GEditor->GetEditorWorldContext().World();
-		if (!World) return FReply::Handled();
+		VolumeClipboardGeometry::BuildPolys(Records[RecordIndex], PreparedPolys[RecordIndex]);
+		PreparedConvex[RecordIndex] = VolumeClipboardGeometry::IsConvex(PreparedPolys[RecordIndex]);
+		PreparedHashes[RecordIndex] = VolumeClipboardGeometry::HashPolys(PreparedPolys[RecordIndex]);
+	});
 
-		// Save current level so we can restore it ONCE at the end
-		ULevel* SavedCurrentLevel = World->GetCurrentLevel();
+	int32 NumPreparedPolys = 0;
+	for (const TArray<FPoly>& Polys : PreparedPolys)
+	{
+		NumPreparedPolys += Polys.Num();
+	}
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Prepared %d polys for %d volumes in %.2f ms on %d worker threads"),
+		NumPreparedPolys, Records.Num(), (FPlatformTime::Seconds() - PrepStart) * 1000.0, FTaskGraphInterface::Get().GetNumWorkerThreads());
+
+	// =========================================================================================
+	// PHASE 2: SPAWN VOLUMES (INSIDE TRANSACTION)
+	// =========================================================================================
+
+	const SIZE_T UndoSizeBefore = GetUndoBufferSize();
+	const int32 PasteTransactionIndex = GEditor->BeginTransaction(LOCTEXT("PasteVolumes", "Paste Volumes"));
+	GEditor->SelectNone(true, true);
+
+	// Compact undo: brush objects of pasted volumes are created non-transactional, so nothing they go through
+	// during the paste is snapshotted. Undo removes the volumes (level and streaming level records), redo brings
+	// them back with the brushes untouched. They become transactional again once the transaction is closed.
+	const EObjectFlags BrushObjectFlags = bCompactUndo ? RF_NoFlags : RF_Transactional;
+	TArray<UObject*> UntrackedBrushObjects;
+
+	TArray<TPair<ALevelStreamingVolume*, const FVolumeRecord*>> PastedStreamingVolumes;
+	VolumeClipboardBrush::FBspCache BspCache;
+	int32 NumBuiltBrushes = 0;
+	int32 NumConvexBrushes = 0;
+	double BspSeconds = 0.0;
+
+	// Bulk mode: no per-actor edit notifications, component / selection updates happen once after the loop
+	const bool bBulk = bBulkPaste;
+	TArray<AVolume*> PastedVolumes;
+	PastedVolumes.Reserve(Records.Num());
+	int32 NumReused = 0;
+	const double SpawnStart = FPlatformTime::Seconds();
+
+	bool bCancelled = false;
+	int32 NumPastedPolys = 0;
+
+	for (int32 RecordIndex = 0; RecordIndex < Records.Num(); RecordIndex++)
+	{
+		// Checked between volumes, so a cancel never leaves a half-built volume behind
+		if (SlowTask.ShouldCancel())
+		{
+			bCancelled = true;
+			break;
+		}
+		SlowTask.EnterProgressFrame(1, FText::Format(LOCTEXT("PasteVolumeProgress", "Pasting volume {0} of {1}"), FText::AsNumber(RecordIndex + 1), FText::AsNumber(Records.Num())));
 
-		// =========================================================================================
-		// PHASE 1: SCAN FOR REQUIRED LEVELS & LOAD THEM IMMEDIATELY
-		// =========================================================================================
-		TSet<FString> RequiredLevelPaths;
-		EAppReturnType::Type MissingLevelResponse = EAppReturnType::Retry;
+		const FVolumeRecord& Rec = Records[RecordIndex];
+		UClass* const* CachedClass = VolumeClasses.Find(Rec.Class);
+		UClass* ActorClass = CachedClass ? *CachedClass : nullptr;
 
-		// 1. Collect all potential level paths from the clipboard JSON
-		for (TSharedPtr<FJsonValue> Val : JsonArray)
+		if (ActorClass && ActorClass->IsChildOf(AVolume::StaticClass()))
 		{
-			TSharedPtr<FJsonObject> Obj = Val->AsObject();
-			if (!Obj.IsValid()) continue;
+			const FString& InternalName = Rec.InternalName;
+
+			// --- 1. DETERMINE TARGET LEVEL ---
+			ULevel* TargetLevel = SavedCurrentLevel; // Default to saved level
 
-			const TSharedPtr<FJsonObject>* PropsPtr;
-			if (Obj->TryGetObjectField("Properties", PropsPtr))
+			if (bPasteToOriginalLevel && Rec.bHasOrigin)
 			{
-				if ((*PropsPtr)->HasField("StreamingLevelNames"))
-				{
-					FString RawNames = (*PropsPtr)->GetStringField("StreamingLevelNames");
-					RawNames = RawNames.Replace(TEXT("("), TEXT("")).Replace(TEXT(")"), TEXT("")).Replace(TEXT("\""), TEXT("")).Replace(TEXT("\'"), TEXT(""));
+				const FString& TargetShortName = Rec.OriginLevel;
+				const FString& TargetPackageName = Rec.OriginLevelPackage;
 
-					TArray<FString> Targets;
-					RawNames.ParseIntoArray(Targets, TEXT(","), true);
-					for (FString& Path : Targets)
-					{
-						FString CleanPath = Path.TrimStartAndEnd();
-						if (!CleanPath.IsEmpty())
-						{
-							RequiredLevelPaths.Add(CleanPath);
-						}
-					}
+				if (ULevel* FoundLevel = LevelLookup.Find(TargetPackageName, TargetShortName))
+				{
+					TargetLevel = FoundLevel;
 				}
 			}
-		}
-
-		// 2. Iterate and Load Levels
-		FString CurrentWorldPkg = World->GetOutermost()->GetName();
-		FString CurrentWorldShort = FPackageName::GetShortName(CurrentWorldPkg);
-
-		for (const FString& PathToCheck : RequiredLevelPaths)
-		{
-			// Check if Package Exists (Prevent crash on invalid path)
-			if (!FPackageName::DoesPackageExist(PathToCheck)) continue;
 
-			// Safety: Don't load self (Recursion Crash Fix)
-			FString CheckShort = FPackageName::GetShortName(PathToCheck);
-			if (PathToCheck == CurrentWorldPkg || CheckShort == CurrentWorldShort) continue;
+			World->SetCurrentLevel(TargetLevel);
 
-			// Check if already loaded
-			bool bIsLoaded = false;
-			for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+			// --- 2. DELETE ORIGINAL (OR REUSE IT) ---
+			AVolume* ReusedVolume = nullptr;
+			if (bDeleteOriginalActor)
 			{
-				if (StreamingLevel && (StreamingLevel->GetWorldAssetPackageName() == PathToCheck || FPackageName::GetShortName(StreamingLevel->GetWorldAssetPackageName()) == CheckShort))
+				AActor* ExistingActor = Cast<AActor>(StaticFindObject(AActor::StaticClass(), TargetLevel, *InternalName));
+				if (ExistingActor && bUpdateExisting && ExistingActor->GetClass() == ActorClass && IsValid(ExistingActor))
 				{
-					bIsLoaded = true;
-					break;
+					ReusedVolume = CastChecked<AVolume>(ExistingActor);
+				}
+				else if (ExistingActor)
+				{
+					FString TrashName = InternalName + TEXT("_TRASH_") + FGuid::NewGuid().ToString();
+					ExistingActor->Rename(*TrashName, nullptr, REN_DontCreateRedirectors | REN_ForceNoResetLoaders);
+					World->EditorDestroyActor(ExistingActor, true);
 				}
 			}
 
-			if (bIsLoaded) continue;
+			// --- 3. SPAWN ---
+			FVector Location = Rec.Location;
+			FQuat Quat = Rec.bHasRotation ? Rec.Rotation : FQuat::Identity;
+			FVector Scale = Rec.Scale;
 
-			// Check User Preference
-			if (MissingLevelResponse == EAppReturnType::NoAll) continue;
+			FTransform FinalTransform;
+			FinalTransform.SetLocation(Location);
+			FinalTransform.SetRotation(Quat);
+			FinalTransform.SetScale3D(Scale);
 
-			bool bShouldLoad = false;
-			if (MissingLevelResponse == EAppReturnType::YesAll)
-			{
-				bShouldLoad = true;
-			}
-			else
+			AVolume* NewVolume = ReusedVolume;
+			if (!NewVolume)
 			{
-				FText Message = FText::Format(LOCTEXT("MissingLevelPrompt", "The Level '{0}' referenced by this volume is not in the current world.\n\nDo you want to add it as a Sub-Level now?"), FText::FromString(CheckShort));
-				MissingLevelResponse = FMessageDialog::Open(EAppMsgType::YesNoYesAllNoAll, Message);
+				FActorSpawnParameters SpawnParams;
+				SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+				SpawnParams.bNoFail = true;
 
-				if (MissingLevelResponse == EAppReturnType::Yes || MissingLevelResponse == EAppReturnType::YesAll)
+				if (bDeleteOriginalActor || StaticFindObject(nullptr, TargetLevel, *InternalName) == nullptr)
 				{
-					bShouldLoad = true;
+					SpawnParams.Name = FName(*InternalName);
 				}
-			}
 
-			if (bShouldLoad)
-			{
-				// CRITICAL FIX: Ensure no actors are selected in the new map, which prevents state corruption during context switches
-				GEditor->SelectNone(true, true);
-				GEditor->NoteSelectionChange();
-
-				// LOAD LEVEL
-				// FIX: Use 'auto' to handle the return type safely.
-				// In UE4.27 this returns ULevel*, but if your build expects ULevelStreaming*, auto handles the assignment.
-				auto NewLevel = UEditorLevelUtils::AddLevelToWorld(World, *PathToCheck, ULevelStreamingDynamic::StaticClass());
-
-				// CRITICAL FIX: FORCE RESET to Persistent Level immediately inside the loop.
-				// AddLevelToWorld automatically sets the new level as "Current".
-				// Failing to reset this causes the NEXT AddLevelToWorld call to try adding a sublevel-to-a-sublevel, which crashes on the 2nd attempt.
-				if (World->PersistentLevel)
+				if (Rec.bHasSpawnMethod && !bBulk)
 				{
-					World->SetCurrentLevel(World->PersistentLevel);
+					SpawnParams.SpawnCollisionHandlingOverride = (ESpawnActorCollisionHandlingMethod)Rec.SpawnMethod;
 				}
 
-				// Flush streaming state to ensure memory is stable before next iteration
-				if (NewLevel)
-				{
-					World->FlushLevelStreaming(EFlushLevelStreamingType::Visibility);
-				}
+				// Bulk mode spawns at the final transform, so it is applied once. AlwaysSpawn is safe, the brush is still empty and can't collide.
+				NewVolume = bBulk
+					? World->SpawnActor<AVolume>(ActorClass, FinalTransform, SpawnParams)
+					: World->SpawnActor<AVolume>(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
 			}
-		}
-
-		// =========================================================================================
-		// PHASE 2: SPAWN VOLUMES (INSIDE TRANSACTION)
-		// =========================================================================================
-
-		GEditor->BeginTransaction(LOCTEXT("PasteVolumes", "Paste Volumes"));
-		GEditor->SelectNone(true, true);
-
-		TArray<ALevelStreamingVolume*> PastedStreamingVolumes;
-
-		for (TSharedPtr<FJsonValue> Val : JsonArray)
-		{
-			TSharedPtr<FJsonObject> Obj = Val->AsObject();
-			if (!Obj.IsValid()) continue;
-
-			FString ClassPath = Obj->GetStringField("Class");
-			UClass* ActorClass = LoadObject<UClass>(nullptr, *ClassPath);
 
-			if (ActorClass && ActorClass->IsChildOf(AVolume::StaticClass()))
+			if (NewVolume)
 			{
-				FString InternalName = Obj->GetStringField("InternalName");
-
-				// --- 1. DETERMINE TARGET LEVEL ---
-				ULevel* TargetLevel = SavedCurrentLevel; // Default to saved level
-				bool bFoundSpecificLevel = false;
-
-				if (bPasteToOriginalLevel && Obj->HasField("OriginLevel"))
+				// Bulk mode skips the edit notifications. A volume spawned inside this transaction is removed on undo without a snapshot,
+				// a reused one still needs its pre-paste state recorded.
+				if (!bBulk)
+				{
+					NewVolume->PreEditChange(nullptr);
+				}
+				else if (ReusedVolume)
+				{
+					ReusedVolume->Modify();
+				}
+				if (!InternalName.IsEmpty() && bDeleteOriginalActor)
 				{
-					FString TargetShortName = Obj->GetStringField("OriginLevel");
-					FString TargetPackageName = "";
-					if (Obj->HasField("OriginLevelPackage")) TargetPackageName = Obj->GetStringField("OriginLevelPackage");
+					if (bBulk)
+					{
+						SetActorLabelQuiet(NewVolume, InternalName);
+					}
+					else
+					{
+						NewVolume->SetActorLabel(InternalName);
+					}
+				}
 
-					if (!TargetPackageName.IsEmpty())
+				if (Rec.bHasBrushType)
+				{
+					NewVolume->BrushType = (EBrushType)Rec.BrushType;
+				}
+				if (Rec.bHasSpawnMethod)
+				{
+					NewVolume->SpawnCollisionHandlingMethod = (ESpawnActorCollisionHandlingMethod)Rec.SpawnMethod;
+				}
+				if (USceneComponent* RootComp = NewVolume->GetRootComponent())
+				{
+					if (Rec.bHasMobility && bBulk)
 					{
-						for (ULevel* Level : World->GetLevels())
+						// SetMobility can re-register, the single ReregisterAllComponents below picks this up
+						if (ReusedVolume)
 						{
-							if (Level && Level->GetOutermost()->GetName() == TargetPackageName)
-							{
-								TargetLevel = Level;
-								bFoundSpecificLevel = true;
-								break;
-							}
+							RootComp->Modify();
 						}
+						RootComp->Mobility = (EComponentMobility::Type)Rec.Mobility;
 					}
-					if (!bFoundSpecificLevel)
+					else if (Rec.bHasMobility)
 					{
-						for (ULevel* Level : World->GetLevels())
-						{
-							if (Level)
-							{
-								FString LoadedLevelName = FPackageName::GetShortName(Level->GetOutermost()->GetName());
-								if (LoadedLevelName == TargetShortName)
-								{
-									TargetLevel = Level;
-									bFoundSpecificLevel = true;
-									break;
-								}
-							}
-						}
+						RootComp->SetMobility((EComponentMobility::Type)Rec.Mobility);
 					}
 				}
 
-				World->SetCurrentLevel(TargetLevel);
-
-				// --- 2. DELETE ORIGINAL ---
-				if (bDeleteOriginalActor)
+				// GEOMETRY
+				if (ReusedVolume && ReusedVolume->Brush)
 				{
-					AActor* ExistingActor = Cast<AActor>(StaticFindObject(AActor::StaticClass(), TargetLevel, *InternalName));
-					if (ExistingActor)
+					// Reused volumes keep their model, only its contents are replaced
+					UModel* Model = ReusedVolume->Brush;
+					Model->Modify();
+					if (Model->Polys)
+					{
+						Model->Polys->Modify();
+						Model->Polys->Element.Reset();
+					}
+					else
 					{
-						FString TrashName = InternalName + TEXT("_TRASH_") + FGuid::NewGuid().ToString();
-						ExistingActor->Rename(*TrashName, nullptr, REN_DontCreateRedirectors | REN_ForceNoResetLoaders);
-						World->EditorDestroyActor(ExistingActor, true);
+						Model->Polys = NewObject<UPolys>(Model, NAME_None, BrushObjectFlags);
+						UntrackedBrushObjects.Add(Model->Polys);
 					}
 				}
-
-				// --- 3. SPAWN ---
-				FVector Location;
-				Location.X = FCString::Atod(*Obj->GetStringField("LocX"));
-				Location.Y = FCString::Atod(*Obj->GetStringField("LocY"));
-				Location.Z = FCString::Atod(*Obj->GetStringField("LocZ"));
-
-				FQuat Quat = FQuat::Identity;
-				if (Obj->HasField("QuatW"))
+				else
 				{
-					Quat.X = FCString::Atod(*Obj->GetStringField("QuatX"));
-					Quat.Y = FCString::Atod(*Obj->GetStringField("QuatY"));
-					Quat.Z = FCString::Atod(*Obj->GetStringField("QuatZ"));
-					Quat.W = FCString::Atod(*Obj->GetStringField("QuatW"));
+					NewVolume->Brush = NewObject<UModel>(NewVolume, NAME_None, BrushObjectFlags);
+					NewVolume->Brush->Initialize(nullptr, true);
+					NewVolume->Brush->Polys = NewObject<UPolys>(NewVolume->Brush, NAME_None, BrushObjectFlags);
+					UntrackedBrushObjects.Add(NewVolume->Brush);
+					UntrackedBrushObjects.Add(NewVolume->Brush->Polys);
 				}
 
-				FVector Scale;
-				Scale.X = FCString::Atod(*Obj->GetStringField("SclX"));
-				Scale.Y = FCString::Atod(*Obj->GetStringField("SclY"));
-				Scale.Z = FCString::Atod(*Obj->GetStringField("SclZ"));
-
-				FActorSpawnParameters SpawnParams;
-				SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-				SpawnParams.bNoFail = true;
-
-				if (bDeleteOriginalActor || StaticFindObject(nullptr, TargetLevel, *InternalName) == nullptr)
+				if (NewVolume->GetBrushComponent())
 				{
-					SpawnParams.Name = FName(*InternalName);
+					NewVolume->GetBrushComponent()->Brush = NewVolume->Brush;
 				}
 
-				if (Obj->HasField("SpawnMethod"))
+				// Primitive records keep a builder so the brush can still be edited through its parameters.
+				// The polys themselves came from the prep step, UCubeBuilder::Build would redo selection and redraw work per volume.
+				if (Rec.BuilderType == VolumeClipboardGeometry::CubeBuilderType && Rec.BuilderParams.Num() == 3)
 				{
-					SpawnParams.SpawnCollisionHandlingOverride = (ESpawnActorCollisionHandlingMethod)(int32)Obj->GetNumberField("SpawnMethod");
+					UCubeBuilder* CubeBuilder = NewObject<UCubeBuilder>(NewVolume, NAME_None, BrushObjectFlags);
+					UntrackedBrushObjects.Add(CubeBuilder);
+					CubeBuilder->X = Rec.BuilderParams[0];
+					CubeBuilder->Y = Rec.BuilderParams[1];
+					CubeBuilder->Z = Rec.BuilderParams[2];
+					NewVolume->BrushBuilder = CubeBuilder;
+				}
+				else if (ReusedVolume)
+				{
+					// A builder left over from the old shape would no longer describe the brush
+					NewVolume->BrushBuilder = nullptr;
 				}
 
-				AVolume* NewVolume = World->SpawnActor<AVolume>(ActorClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
-
-				if (NewVolume)
+				// Polys were built on worker threads before the transaction, only the hand-over happens here
+				TArray<FPoly>& Polys = PreparedPolys[RecordIndex];
+				NumPastedPolys += Polys.Num();
+				NewVolume->Brush->Polys->Element.Reserve(Polys.Num());
+				for (FPoly& NewPoly : Polys)
 				{
-					NewVolume->PreEditChange(nullptr);
-					if (!InternalName.IsEmpty() && bDeleteOriginalActor) NewVolume->SetActorLabel(InternalName);
+					NewVolume->Brush->Polys->Element.Add(MoveTemp(NewPoly));
+				}
 
-					if (Obj->HasField("BrushType"))
-					{
-						NewVolume->BrushType = (EBrushType)(int32)Obj->GetNumberField("BrushType");
-					}
-					if (Obj->HasField("SpawnMethod"))
-					{
-						NewVolume->SpawnCollisionHandlingMethod = (ESpawnActorCollisionHandlingMethod)(int32)Obj->GetNumberField("SpawnMethod");
-					}
-					if (NewVolume->GetRootComponent() && Obj->HasField("Mobility"))
+				// Convex brushes skip bspBuild entirely, the rest use the selected quality (csgPrepMovingBrush rebuilt with BSP_Good anyway)
+				// Identical shapes earlier in this paste hand over their BSP instead of building it again
+				const double BspStart = FPlatformTime::Seconds();
+				if (!BspCache.Apply(NewVolume->Brush, PreparedHashes[RecordIndex]))
+				{
+					if (VolumeClipboardBrush::BuildBrushBsp(NewVolume->Brush, PreparedConvex[RecordIndex], (FBSPOps::EBspOptimization)BspQuality))
 					{
-						NewVolume->GetRootComponent()->SetMobility((EComponentMobility::Type)(int32)Obj->GetNumberField("Mobility"));
+						NumConvexBrushes++;
 					}
+					BspCache.Store(NewVolume->Brush, PreparedHashes[RecordIndex]);
+					NumBuiltBrushes++;
+				}
+				BspSeconds += FPlatformTime::Seconds() - BspStart;
+				NewVolume->Brush->BuildBound();
 
-					// GEOMETRY
-					NewVolume->Brush = NewObject<UModel>(NewVolume, NAME_None, RF_Transactional);
-					NewVolume->Brush->Initialize(nullptr, true);
-					NewVolume->Brush->Polys = NewObject<UPolys>(NewVolume->Brush, NAME_None, RF_Transactional);
+				// A spawned volume starts from the defaults, a reused one has to get there first for properties the record leaves out
+				if (ReusedVolume)
+				{
+					ResetUnlistedProperties(NewVolume, Rec.Properties);
+					NumReused++;
+				}
 
-					if (NewVolume->GetBrushComponent())
-					{
-						NewVolume->GetBrushComponent()->Brush = NewVolume->Brush;
-					}
+				RestoreObjectProperties(NewVolume, Rec.Properties);
 
-					const TArray<TSharedPtr<FJsonValue>>* PolyArray;
-					if (Obj->TryGetArrayField("RawPolys", PolyArray))
-					{
-						for (const auto& PolyVal : *PolyArray)
-						{
-							TSharedPtr<FJsonObject> PolyObj = PolyVal->AsObject();
-							if (!PolyObj.IsValid()) continue;
-
-							FPoly NewPoly;
-							NewPoly.Init();
-
-							if (PolyObj->HasField("Flags")) NewPoly.PolyFlags = (uint32)PolyObj->GetNumberField("Flags");
-							else NewPoly.PolyFlags = PF_NotSolid;
-
-							const TArray<TSharedPtr<FJsonValue>>* VertArray;
-							if (PolyObj->TryGetArrayField("Verts", VertArray))
-							{
-								for (const auto& VVal : *VertArray)
-								{
-									TSharedPtr<FJsonObject> VObj = VVal->AsObject();
-									if (!VObj.IsValid()) continue;
-									FVector Vertex;
-									Vertex.X = VObj->GetNumberField("X");
-									Vertex.Y = VObj->GetNumberField("Y");
-									Vertex.Z = VObj->GetNumberField("Z");
-									NewPoly.Vertices.Add(Vertex);
-								}
-							}
-							if (NewPoly.Vertices.Num() >= 3)
-							{
-								NewPoly.Base = NewPoly.Vertices[0];
-								NewPoly.Finalize(NewVolume, 0);
-								NewVolume->Brush->Polys->Element.Add(NewPoly);
-							}
-						}
-					}
+				RestoreComponentProperties(NewVolume, Rec.Components, ReusedVolume != nullptr);
 
-					FBSPOps::bspBuild(NewVolume->Brush, FBSPOps::BSP_Optimal, 15, 70, 1, 0);
-					FBSPOps::csgPrepMovingBrush(NewVolume);
-					NewVolume->Brush->BuildBound();
+				// Store for Link Phase
+				if (ALevelStreamingVolume* StreamingVol = Cast<ALevelStreamingVolume>(NewVolume))
+				{
+					PastedStreamingVolumes.Emplace(StreamingVol, &Rec);
+				}
 
-					const TSharedPtr<FJsonObject>* PropsObject;
-					if (Obj->TryGetObjectField("Properties", PropsObject))
+				PastedVolumes.Add(NewVolume);
+				if (bBulk)
+				{
+					if (ReusedVolume)
 					{
-						RestoreObjectProperties(NewVolume, *PropsObject);
+						NewVolume->SetActorTransform(FinalTransform, false, nullptr, ETeleportType::TeleportPhysics);
 					}
+					continue;
+				}
 
-					const TArray<TSharedPtr<FJsonValue>>* ComponentsArray;
-					if (Obj->TryGetArrayField("Components", ComponentsArray))
-					{
-						for (const auto& CompVal : *ComponentsArray)
-						{
-							TSharedPtr<FJsonObject> CompData = CompVal->AsObject();
-							FString CompClass = CompData->GetStringField("ClassName");
-							const TSharedPtr<FJsonObject>* CompProps;
-							if (CompData->TryGetObjectField("Props", CompProps))
-							{
-								for (UActorComponent* ExistingComp : NewVolume->GetComponents())
-								{
-									if (ExistingComp->GetClass()->GetName() == CompClass)
-									{
-										RestoreObjectProperties(ExistingComp, *CompProps);
-									}
-								}
-							}
-						}
-					}
+				NewVolume->PostEditChange();
 
-					// Store for Link Phase
-					if (ALevelStreamingVolume* StreamingVol = Cast<ALevelStreamingVolume>(NewVolume))
-					{
-						PastedStreamingVolumes.Add(StreamingVol);
-					}
+				if (USceneComponent* RootComp = NewVolume->GetRootComponent())
+				{
+					RootComp->SetRelativeTransform(FinalTransform, false, nullptr, ETeleportType::TeleportPhysics);
+					RootComp->UpdateBounds();
+				}
+				else
+				{
+					NewVolume->SetActorTransform(FinalTransform, false, nullptr, ETeleportType::TeleportPhysics);
+				}
 
-					NewVolume->PostEditChange();
-					FTransform FinalTransform;
-					FinalTransform.SetLocation(Location);
-					FinalTransform.SetRotation(Quat);
-					FinalTransform.SetScale3D(Scale);
+				GEditor->SelectActor(NewVolume, true, false);
+			}
+		}
+	}
 
-					if (USceneComponent* RootComp = NewVolume->GetRootComponent())
-					{
-						RootComp->SetRelativeTransform(FinalTransform, false, nullptr, ETeleportType::TeleportPhysics);
-						RootComp->UpdateBounds();
-					}
-					else
-					{
-						NewVolume->SetActorTransform(FinalTransform, false, nullptr, ETeleportType::TeleportPhysics);
-					}
+	SlowTask.EnterProgressFrame(1, LOCTEXT("PasteFinalize", "Updating pasted volumes"));
+	if (bBulk && !bCancelled)
+	{
+		// One pass instead of PostEditChange per actor: collision from the new brush, then a single re-register
+		// which recreates render / physics state and bounds (and reruns construction scripts of blueprint volumes)
+		for (AVolume* Volume : PastedVolumes)
+		{
+			if (UBrushComponent* BrushComp = Volume->GetBrushComponent())
+			{
+				BrushComp->RequestUpdateBrushCollision();
+			}
 
-					GEditor->SelectActor(NewVolume, true, false);
-				}
+			if (Volume->GetClass()->ClassGeneratedBy)
+			{
+				Volume->RerunConstructionScripts();
+			}
+			else
+			{
+				Volume->ReregisterAllComponents();
 			}
 		}
 
-		if (SavedCurrentLevel)
+		USelection* SelectedActors = GEditor->GetSelectedActors();
+		SelectedActors->BeginBatchSelectOperation();
+		for (AVolume* Volume : PastedVolumes)
 		{
-			World->SetCurrentLevel(SavedCurrentLevel);
+			GEditor->SelectActor(Volume, true, false);
 		}
+		SelectedActors->EndBatchSelectOperation(false);
+		GEditor->NoteSelectionChange();
+	}
+
+	const double SpawnSeconds = FPlatformTime::Seconds() - SpawnStart;
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Pasted %d volumes (%d updated in place) in %.2f ms, %.3f ms per volume (bulk mode %s)"),
+		PastedVolumes.Num(), NumReused, SpawnSeconds * 1000.0, PastedVolumes.Num() > 0 ? SpawnSeconds * 1000.0 / PastedVolumes.Num() : 0.0, bBulk ? TEXT("on") : TEXT("off"));
+
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Built %d brushes in %.2f ms: %d convex fast path, %d bspBuild (%s)"),
+		NumBuiltBrushes, BspSeconds * 1000.0, NumConvexBrushes, NumBuiltBrushes - NumConvexBrushes, *GetBspQualityText().ToString());
+	UE_LOG(LogVolumeClipboard, Log, TEXT("BSP cache: %d hits / %d lookups (%.1f%%), %d unique shapes"),
+		BspCache.GetNumHits(), BspCache.GetNumLookups(), BspCache.GetNumLookups() > 0 ? 100.0 * BspCache.GetNumHits() / BspCache.GetNumLookups() : 0.0, BspCache.GetNumShapes());
 
-		// =========================================================================================
-		// PHASE 3: RELINK VOLUMES (INSIDE TRANSACTION)
-		// =========================================================================================
+	if (SavedCurrentLevel)
+	{
+		World->SetCurrentLevel(SavedCurrentLevel);
+	}
 
-		for (ALevelStreamingVolume* StreamingVol : PastedStreamingVolumes)
+	if (bCancelled)
+	{
+		// Revert what the open transaction recorded (spawns, destroyed originals, in-place updates), then drop it.
+		// Ending and undoing instead would hit the user's previous edit if nothing had been recorded yet.
+		if (GUndo)
 		{
-			if (!StreamingVol || !IsValid(StreamingVol)) continue;
+			GUndo->Apply();
+		}
+		GEditor->CancelTransaction(PasteTransactionIndex);
+		GEditor->RedrawAllViewports(true);
 
-			// We already loaded all missing levels in Phase 1, so they are guaranteed to exist now.
-			TArray<FName> RequiredLevelNames = StreamingVol->StreamingLevelNames;
+		UE_LOG(LogVolumeClipboard, Warning, TEXT("Paste cancelled after %d of %d volumes, changes were rolled back."), PastedVolumes.Num(), Records.Num());
+		return;
+	}
 
-			for (const FName& RequiredName : RequiredLevelNames)
-			{
-				FString RequiredPath = RequiredName.ToString();
-				FString TargetShort = FPackageName::GetShortName(RequiredPath);
+	// =========================================================================================
+	// PHASE 3: RELINK VOLUMES (INSIDE TRANSACTION)
+	// =========================================================================================
 
-				for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
-				{
-					if (StreamingLevel)
-					{
-						FString StreamPkg = StreamingLevel->GetWorldAssetPackageName();
-						FString StreamShort = FPackageName::GetShortName(StreamPkg);
+	SlowTask.EnterProgressFrame(1, LOCTEXT("PasteRelink", "Relinking streaming volumes"));
 
-						if (StreamPkg == RequiredPath || StreamShort == TargetShort)
-						{
-							StreamingLevel->Modify();
-							StreamingLevel->EditorStreamingVolumes.AddUnique(StreamingVol);
-						}
-					}
+	// We already loaded all missing levels in Phase 1, so they are guaranteed to exist now.
+	FStreamingLevelIndex StreamingIndex;
+	StreamingIndex.Build(World);
+
+	// Links are gathered per streaming level first, so each level is modified once and appended in bulk
+	struct FPendingLink
+	{
+		int32 Slot;
+		ALevelStreamingVolume* Volume;
+	};
+	TMap<ULevelStreaming*, TArray<FPendingLink>> PendingLinks;
+
+	for (const TPair<ALevelStreamingVolume*, const FVolumeRecord*>& Pasted : PastedStreamingVolumes)
+	{
+		ALevelStreamingVolume* StreamingVol = Pasted.Key;
+		if (!StreamingVol || !IsValid(StreamingVol)) continue;
+
+		TSet<ULevelStreaming*, DefaultKeyFuncs<ULevelStreaming*>, TInlineSetAllocator<8>> LinkedLevels;
+		auto AddLinks = [&](const FString& Path, int32 Slot)
+		{
+			StreamingIndex.ForEachMatch(Path, [&](ULevelStreaming* StreamingLevel)
+			{
+				bool bAlreadyLinked = false;
+				LinkedLevels.Add(StreamingLevel, &bAlreadyLinked);
+				if (!bAlreadyLinked)
+				{
+					PendingLinks.FindOrAdd(StreamingLevel).Add({ Slot, StreamingVol });
 				}
+			});
+		};
+
+		// Exported links carry the slot the volume had in each level, which keeps the original volume order
+		for (const FVolumeStreamLinkRecord& Link : Pasted.Value->StreamLinks)
+		{
+			AddLinks(Link.Package, Link.Slot);
+		}
+
+		// Records without links (older / external data) still relink from StreamingLevelNames, after the slotted ones
+		for (const FName& RequiredName : StreamingVol->StreamingLevelNames)
+		{
+			AddLinks(RequiredName.ToString(), MAX_int32);
+		}
+	}
+
+	int32 NumLinksAdded = 0;
+	int32 NumLevelsModified = 0;
+	for (TPair<ULevelStreaming*, TArray<FPendingLink>>& Pending : PendingLinks)
+	{
+		ULevelStreaming* StreamingLevel = Pending.Key;
+		TArray<FPendingLink>& Links = Pending.Value;
+		Links.StableSort([](const FPendingLink& A, const FPendingLink& B) { return A.Slot < B.Slot; });
+
+		TSet<ALevelStreamingVolume*> ExistingVolumes(StreamingLevel->EditorStreamingVolumes);
+		bool bModified = false;
+
+		for (const FPendingLink& Link : Links)
+		{
+			bool bAlreadyLinked = false;
+			ExistingVolumes.Add(Link.Volume, &bAlreadyLinked);
+			if (bAlreadyLinked) continue;
+
+			if (!bModified)
+			{
+				StreamingLevel->Modify();
+				bModified = true;
+				NumLevelsModified++;
 			}
+			StreamingLevel->EditorStreamingVolumes.Add(Link.Volume);
+			NumLinksAdded++;
 		}
+	}
 
-		GEditor->EndTransaction();
-		GEditor->RebuildAlteredBSP();
-		GEditor->RedrawAllViewports(true);
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Relinked %d streaming volumes: %d links added across %d streaming levels"), PastedStreamingVolumes.Num(), NumLinksAdded, NumLevelsModified);
+
+	GEditor->EndTransaction();
+
+	// Later edits of the pasted brushes (geometry mode, builder changes) must be undoable again
+	if (bCompactUndo)
+	{
+		for (UObject* BrushObject : UntrackedBrushObjects)
+		{
+			BrushObject->SetFlags(RF_Transactional);
+		}
 	}
 
-	return FReply::Handled();
+	const SIZE_T UndoSizeAfter = GetUndoBufferSize();
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Undo buffer: %.1f KB before paste, %.1f KB after (%s undo, %d brush objects untracked)"),
+		UndoSizeBefore / 1024.0, UndoSizeAfter / 1024.0, bCompactUndo ? TEXT("compact") : TEXT("full"), bCompactUndo ? UntrackedBrushObjects.Num() : 0);
+
+	GEditor->RebuildAlteredBSP();
+	GEditor->RedrawAllViewports(true);
+
+	const double PasteSeconds = FMath::Max(FPlatformTime::Seconds() - PasteStart, SMALL_NUMBER);
+	UE_LOG(LogVolumeClipboard, Log, TEXT("Paste finished: %d volumes, %d polys in %.2f s (%.0f volumes/s, %.0f polys/s)"),
+		PastedVolumes.Num(), NumPastedPolys, PasteSeconds, PastedVolumes.Num() / PasteSeconds, NumPastedPolys / PasteSeconds);
 }
 
 #undef LOCTEXT_NAMESPACE
 
-IMPLEMENT_MODULE(FVolumeClipboardModule, VolumeClipboard)
\ No newline at end of file
+IMPLEMENT_MODULE(FVolumeClipboardModule, VolumeClipboard)
@@ -0,0 +1,472 @@
+#include "VolumeClipboardBinary.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Base64.h"
+
+namespace VolumeClipboardBinary
+{
+	static const TCHAR* TextPrefix = TEXT("VCLB:");
+
+	enum EFieldMask : uint32
+	{
+		FIELD_Origin		= 1 << 0,
+		FIELD_StreamLinks	= 1 << 1,
+		FIELD_Rotation		= 1 << 2,
+		FIELD_SpawnMethod	= 1 << 3,
+		FIELD_Mobility		= 1 << 4,
+		FIELD_BrushType		= 1 << 5,
+		FIELD_Model			= 1 << 6,
+		FIELD_Indexed		= 1 << 7,
+		FIELD_Builder		= 1 << 8,
+	};
+
+	// FString keys hash case-insensitively by default, which would merge property text like "True"/"true"
+	struct FStringTableKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static FORCEINLINE bool Matches(KeyInitType A, KeyInitType B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static FORCEINLINE uint32 GetKeyHash(KeyInitType Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	class FStringTableBuilder
+	{
+	public:
+		int32 Add(const FString& Str)
+		{
+			if (const int32* Existing = Index.Find(Str))
+			{
+				return *Existing;
+			}
+			const int32 NewIndex = Strings.Add(Str);
+			Index.Add(Str, NewIndex);
+			return NewIndex;
+		}
+
+		TArray<FString> Strings;
+
+	private:
+		TMap<FString, int32, FDefaultSetAllocator, FStringTableKeyFuncs> Index;
+	};
+
+	static void WriteStringRef(FArchive& Ar, FStringTableBuilder& StringTable, const FString& Str)
+	{
+		int32 StringIndex = StringTable.Add(Str);
+		Ar << StringIndex;
+	}
+
+	static void WriteProps(FArchive& Ar, FStringTableBuilder& StringTable, const TArray<FVolumePropertyRecord>& Props)
+	{
+		int32 NumProps = Props.Num();
+		Ar << NumProps;
+		for (const FVolumePropertyRecord& Prop : Props)
+		{
+			WriteStringRef(Ar, StringTable, Prop.Name);
+
+			uint8 Encoding = (uint8)Prop.Encoding;
+			Ar << Encoding;
+
+			if (Prop.Encoding == EVolumePropertyEncoding::Text || Prop.Encoding == EVolumePropertyEncoding::Name)
+			{
+				WriteStringRef(Ar, StringTable, Prop.Value);
+			}
+			else
+			{
+				uint64 Raw = Prop.Raw;
+				Ar << Raw;
+			}
+		}
+	}
+
+	void Write(FArchive& Ar, const TArray<FVolumeRecord>& Records)
+	{
+		check(Ar.IsSaving());
+
+		// The volume section is encoded first so the string table is complete before the header goes out
+		FStringTableBuilder StringTable;
+		TArray<uint8> VolumeBytes;
+		FMemoryWriter VolumeAr(VolumeBytes);
+
+		int32 NumVertices = 0;
+		int32 NumPolys = 0;
+		int32 NumIndices = 0;
+
+		for (const FVolumeRecord& Rec : Records)
+		{
+			uint32 Mask = 0;
+			if (Rec.bHasOrigin) Mask |= FIELD_Origin;
+			if (Rec.bHasStreamLinks) Mask |= FIELD_StreamLinks;
+			if (Rec.bHasRotation) Mask |= FIELD_Rotation;
+			if (Rec.bHasSpawnMethod) Mask |= FIELD_SpawnMethod;
+			if (Rec.bHasMobility) Mask |= FIELD_Mobility;
+			if (Rec.bHasBrushType) Mask |= FIELD_BrushType;
+			if (Rec.bHasModel) Mask |= FIELD_Model;
+			if (Rec.bIndexed) Mask |= FIELD_Indexed;
+			if (Rec.BuilderParams.Num() > 0) Mask |= FIELD_Builder;
+			VolumeAr << Mask;
+
+			WriteStringRef(VolumeAr, StringTable, Rec.Class);
+			WriteStringRef(VolumeAr, StringTable, Rec.InternalName);
+			WriteStringRef(VolumeAr, StringTable, Rec.OriginLevel);
+			WriteStringRef(VolumeAr, StringTable, Rec.OriginLevelPackage);
+			WriteStringRef(VolumeAr, StringTable, Rec.BuilderType);
+
+			FVector Location = Rec.Location;
+			FQuat Rotation = Rec.Rotation;
+			FVector Scale = Rec.Scale;
+			VolumeAr << Location << Rotation << Scale;
+
+			uint8 SpawnMethod = (uint8)Rec.SpawnMethod;
+			uint8 Mobility = (uint8)Rec.Mobility;
+			uint8 BrushType = (uint8)Rec.BrushType;
+			VolumeAr << SpawnMethod << Mobility << BrushType;
+
+			int32 NumLinks = Rec.StreamLinks.Num();
+			VolumeAr << NumLinks;
+			for (const FVolumeStreamLinkRecord& Link : Rec.StreamLinks)
+			{
+				WriteStringRef(VolumeAr, StringTable, Link.Package);
+				int32 Slot = Link.Slot;
+				VolumeAr << Slot;
+			}
+
+			WriteProps(VolumeAr, StringTable, Rec.Properties);
+
+			int32 NumComponents = Rec.Components.Num();
+			VolumeAr << NumComponents;
+			for (const FVolumeComponentRecord& Comp : Rec.Components)
+			{
+				WriteStringRef(VolumeAr, StringTable, Comp.ClassName);
+				WriteProps(VolumeAr, StringTable, Comp.Props);
+			}
+
+			int32 FirstPoly = NumPolys;
+			int32 PolyCount = Rec.Polys.Num();
+			VolumeAr << FirstPoly << PolyCount;
+
+			if (Rec.bIndexed)
+			{
+				int32 FirstPoint = NumVertices;
+				int32 PointCount = Rec.Vertices.Num();
+				VolumeAr << FirstPoint << PointCount;
+				NumIndices += Rec.Indices.Num();
+			}
+
+			if (Mask & FIELD_Builder)
+			{
+				int32 NumParams = Rec.BuilderParams.Num();
+				VolumeAr << NumParams;
+				for (float Param : Rec.BuilderParams)
+				{
+					VolumeAr << Param;
+				}
+				uint32 BuilderFlags = Rec.BuilderFlags;
+				VolumeAr << BuilderFlags;
+			}
+
+			NumPolys += PolyCount;
+			NumVertices += Rec.Vertices.Num();
+		}
+
+		// --- HEADER ---
+		uint32 MagicValue = Magic;
+		uint32 Version = VER_Latest;
+		int32 NumStrings = StringTable.Strings.Num();
+		int32 NumVolumes = Records.Num();
+		Ar << MagicValue << Version << NumStrings << NumVertices << NumPolys << NumVolumes << NumIndices;
+
+		// --- STRING TABLE ---
+		for (FString& Str : StringTable.Strings)
+		{
+			Ar << Str;
+		}
+
+		// --- VERTEX POOL ---
+		for (const FVolumeRecord& Rec : Records)
+		{
+			for (FVector Vertex : Rec.Vertices)
+			{
+				Ar << Vertex;
+			}
+		}
+
+		// --- POLY TABLE ---
+		int32 VertexBase = 0;
+		int32 IndexBase = 0;
+		for (const FVolumeRecord& Rec : Records)
+		{
+			const int32 RangeBase = Rec.bIndexed ? IndexBase : VertexBase;
+			for (const FVolumePolyRecord& Poly : Rec.Polys)
+			{
+				uint32 Flags = Poly.Flags;
+				int32 FirstVertex = RangeBase + Poly.FirstVertex;
+				int32 PolyVertices = Poly.NumVertices;
+				Ar << Flags << FirstVertex << PolyVertices;
+			}
+			VertexBase += Rec.Vertices.Num();
+			if (Rec.bIndexed) IndexBase += Rec.Indices.Num();
+		}
+
+		// --- INDEX POOL ---
+		for (const FVolumeRecord& Rec : Records)
+		{
+			if (!Rec.bIndexed) continue;
+			for (int32 Index : Rec.Indices)
+			{
+				Ar << Index;
+			}
+		}
+
+		// --- VOLUMES ---
+		Ar.Serialize(VolumeBytes.GetData(), VolumeBytes.Num());
+	}
+
+	bool Read(FArchive& Ar, TArray<FVolumeRecord>& OutRecords)
+	{
+		check(Ar.IsLoading());
+
+		uint32 MagicValue = 0;
+		uint32 Version = 0;
+		Ar << MagicValue << Version;
+
+		if (Ar.IsError() || MagicValue != Magic)
+		{
+			return false;
+		}
+		if (Version == 0 || Version > VER_Latest)
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("Volume archive version %u is not supported (latest is %u)."), Version, (uint32)VER_Latest);
+			return false;
+		}
+
+		int32 NumStrings = 0;
+		int32 NumVertices = 0;
+		int32 NumPolys = 0;
+		int32 NumVolumes = 0;
+		int32 NumIndices = 0;
+		Ar << NumStrings << NumVertices << NumPolys << NumVolumes;
+		if (Version >= VER_IndexedPolys)
+		{
+			Ar << NumIndices;
+		}
+
+		// Every entry takes at least one byte, so reject counts the archive can't possibly hold before allocating
+		const int64 Remaining = Ar.TotalSize() - Ar.Tell();
+		if (Ar.IsError() || NumStrings < 0 || NumVertices < 0 || NumPolys < 0 || NumVolumes < 0 || NumIndices < 0 ||
+			NumStrings > Remaining || NumVertices > Remaining || NumPolys > Remaining || NumVolumes > Remaining || NumIndices > Remaining)
+		{
+			return false;
+		}
+
+		TArray<FString> Strings;
+		Strings.SetNum(NumStrings);
+		for (FString& Str : Strings)
+		{
+			Ar << Str;
+		}
+
+		TArray<FVector> Vertices;
+		Vertices.SetNumUninitialized(NumVertices);
+		for (FVector& Vertex : Vertices)
+		{
+			Ar << Vertex;
+		}
+
+		// Ranges are checked against the right pool once the owning volume is known
+		TArray<FVolumePolyRecord> Polys;
+		Polys.SetNum(NumPolys);
+		for (FVolumePolyRecord& Poly : Polys)
+		{
+			Ar << Poly.Flags << Poly.FirstVertex << Poly.NumVertices;
+		}
+
+		TArray<int32> Indices;
+		Indices.SetNumUninitialized(NumIndices);
+		for (int32& Index : Indices)
+		{
+			Ar << Index;
+		}
+
+		if (Ar.IsError()) return false;
+
+		auto ReadStringRef = [&Ar, &Strings](FString& Out) -> bool
+		{
+			int32 StringIndex = INDEX_NONE;
+			Ar << StringIndex;
+			if (!Strings.IsValidIndex(StringIndex)) return false;
+			Out = Strings[StringIndex];
+			return true;
+		};
+
+		auto ReadProps = [&Ar, &ReadStringRef, Version](TArray<FVolumePropertyRecord>& OutProps) -> bool
+		{
+			int32 NumProps = 0;
+			Ar << NumProps;
+			if (Ar.IsError() || NumProps < 0 || NumProps > Ar.TotalSize() - Ar.Tell()) return false;
+
+			OutProps.SetNum(NumProps);
+			for (FVolumePropertyRecord& Prop : OutProps)
+			{
+				if (!ReadStringRef(Prop.Name)) return false;
+
+				// Older archives only store text
+				if (Version >= VER_TypedProperties)
+				{
+					uint8 Encoding = 0;
+					Ar << Encoding;
+					if (Ar.IsError() || Encoding >= (uint8)EVolumePropertyEncoding::Count) return false;
+					Prop.Encoding = (EVolumePropertyEncoding)Encoding;
+				}
+
+				if (Prop.Encoding == EVolumePropertyEncoding::Text || Prop.Encoding == EVolumePropertyEncoding::Name)
+				{
+					if (!ReadStringRef(Prop.Value)) return false;
+				}
+				else
+				{
+					Ar << Prop.Raw;
+				}
+			}
+			return true;
+		};
+
+		OutRecords.Reserve(OutRecords.Num() + NumVolumes);
+		for (int32 VolumeIndex = 0; VolumeIndex < NumVolumes; VolumeIndex++)
+		{
+			FVolumeRecord& Rec = OutRecords.AddDefaulted_GetRef();
+
+			uint32 Mask = 0;
+			Ar << Mask;
+			Rec.bHasOrigin = (Mask & FIELD_Origin) != 0;
+			Rec.bHasStreamLinks = (Mask & FIELD_StreamLinks) != 0;
+			Rec.bHasRotation = (Mask & FIELD_Rotation) != 0;
+			Rec.bHasSpawnMethod = (Mask & FIELD_SpawnMethod) != 0;
+			Rec.bHasMobility = (Mask & FIELD_Mobility) != 0;
+			Rec.bHasBrushType = (Mask & FIELD_BrushType) != 0;
+			Rec.bHasModel = (Mask & FIELD_Model) != 0;
+			Rec.bIndexed = (Mask & FIELD_Indexed) != 0 && Version >= VER_IndexedPolys;
+
+			if (!ReadStringRef(Rec.Class) || !ReadStringRef(Rec.InternalName) ||
+				!ReadStringRef(Rec.OriginLevel) || !ReadStringRef(Rec.OriginLevelPackage) ||
+				!ReadStringRef(Rec.BuilderType))
+			{
+				return false;
+			}
+
+			Ar << Rec.Location << Rec.Rotation << Rec.Scale;
+
+			uint8 SpawnMethod = 0;
+			uint8 Mobility = 0;
+			uint8 BrushType = 0;
+			Ar << SpawnMethod << Mobility << BrushType;
+			Rec.SpawnMethod = SpawnMethod;
+			Rec.Mobility = Mobility;
+			Rec.BrushType = BrushType;
+
+			int32 NumLinks = 0;
+			Ar << NumLinks;
+			if (Ar.IsError() || NumLinks < 0 || NumLinks > Ar.TotalSize() - Ar.Tell()) return false;
+
+			Rec.StreamLinks.SetNum(NumLinks);
+			for (FVolumeStreamLinkRecord& Link : Rec.StreamLinks)
+			{
+				if (!ReadStringRef(Link.Package)) return false;
+				Ar << Link.Slot;
+			}
+
+			if (!ReadProps(Rec.Properties)) return false;
+
+			int32 NumComponents = 0;
+			Ar << NumComponents;
+			if (Ar.IsError() || NumComponents < 0 || NumComponents > Ar.TotalSize() - Ar.Tell()) return false;
+
+			Rec.Components.SetNum(NumComponents);
+			for (FVolumeComponentRecord& Comp : Rec.Components)
+			{
+				if (!ReadStringRef(Comp.ClassName) || !ReadProps(Comp.Props)) return false;
+			}
+
+			int32 FirstPoly = 0;
+			int32 PolyCount = 0;
+			Ar << FirstPoly << PolyCount;
+			if (Ar.IsError() || FirstPoly < 0 || PolyCount < 0 || PolyCount > NumPolys - FirstPoly) return false;
+
+			int32 FirstPoint = 0;
+			int32 PointCount = 0;
+			if (Rec.bIndexed)
+			{
+				Ar << FirstPoint << PointCount;
+				if (Ar.IsError() || FirstPoint < 0 || PointCount < 0 || PointCount > NumVertices - FirstPoint) return false;
+				Rec.Vertices.Append(Vertices.GetData() + FirstPoint, PointCount);
+			}
+
+			// Rebase the shared pool ranges into the record's own arrays
+			const int32 RangeLimit = Rec.bIndexed ? NumIndices : NumVertices;
+			Rec.Polys.Reserve(PolyCount);
+			for (int32 PolyIndex = FirstPoly; PolyIndex < FirstPoly + PolyCount; PolyIndex++)
+			{
+				const FVolumePolyRecord& Src = Polys[PolyIndex];
+				if (Src.FirstVertex < 0 || Src.NumVertices < 0 || Src.NumVertices > RangeLimit - Src.FirstVertex) return false;
+
+				FVolumePolyRecord& Dst = Rec.Polys.AddDefaulted_GetRef();
+				Dst.Flags = Src.Flags;
+				Dst.NumVertices = Src.NumVertices;
+
+				if (Rec.bIndexed)
+				{
+					Dst.FirstVertex = Rec.Indices.Num();
+					Rec.Indices.Append(Indices.GetData() + Src.FirstVertex, Src.NumVertices);
+				}
+				else
+				{
+					Dst.FirstVertex = Rec.Vertices.Num();
+					Rec.Vertices.Append(Vertices.GetData() + Src.FirstVertex, Src.NumVertices);
+				}
+			}
+
+			if ((Mask & FIELD_Builder) && Version >= VER_BuilderParams)
+			{
+				int32 NumParams = 0;
+				Ar << NumParams;
+				if (Ar.IsError() || NumParams < 0 || NumParams > Ar.TotalSize() - Ar.Tell()) return false;
+
+				Rec.BuilderParams.SetNumUninitialized(NumParams);
+				for (float& Param : Rec.BuilderParams)
+				{
+					Ar << Param;
+				}
+				Ar << Rec.BuilderFlags;
+			}
+
+			if (!Rec.HasValidGeometry()) return false;
+		}
+
+		return !Ar.IsError();
+	}
+
+	FString EncodeToText(const TArray<FVolumeRecord>& Records)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Write(Writer, Records);
+
+		return FString(TextPrefix) + FBase64::Encode(Bytes);
+	}
+
+	bool IsEncodedText(const FString& Text)
+	{
+		return Text.StartsWith(TextPrefix, ESearchCase::CaseSensitive);
+	}
+
+	bool DecodeFromText(const FString& Text, TArray<FVolumeRecord>& OutRecords)
+	{
+		if (!IsEncodedText(Text)) return false;
+
+		TArray<uint8> Bytes;
+		if (!FBase64::Decode(Text.Mid(FCString::Strlen(TextPrefix)).TrimStartAndEnd(), Bytes))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes);
+		return Read(Reader, OutRecords);
+	}
+}
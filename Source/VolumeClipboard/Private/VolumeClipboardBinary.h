@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VolumeClipboardTypes.h"
+
+// ---------------------------------------------------------
+// Compact binary volume archive.
+//
+// Layout (all counts are int32):
+//   Header      : Magic, Version, NumStrings, NumVertices, NumPolys, NumVolumes, NumIndices
+//   String table: FString x NumStrings (class paths, level packages, names, property text)
+//   Vertex pool : FVector x NumVertices
+//   Poly table  : Flags, FirstVertex, NumVertices (ranges into the vertex pool, or the index pool for indexed volumes)
+//   Index pool  : int32 x NumIndices (relative to the owning volume's point range)
+//   Volumes     : field mask, string indices, transform, enums, links, properties, poly range, point range, builder
+//                 (properties: name index, encoding, then a string index for text / names or the raw 64-bit value)
+//                 (builder: parameter count, float parameters, poly flags, only for primitive brushes)
+// ---------------------------------------------------------
+namespace VolumeClipboardBinary
+{
+	static const uint32 Magic = 0x424C4356; // "VCLB"
+
+	enum EVersion : uint32
+	{
+		VER_Initial = 1,
+		VER_IndexedPolys = 2,
+		VER_TypedProperties = 3,
+		VER_BuilderParams = 4,
+
+		VER_Latest = VER_BuilderParams
+	};
+
+	/** Writes the records as one archive. Ar must be a saving archive. */
+	void Write(FArchive& Ar, const TArray<FVolumeRecord>& Records);
+
+	/** Reads an archive produced by Write. Returns false on malformed or unsupported data. */
+	bool Read(FArchive& Ar, TArray<FVolumeRecord>& OutRecords);
+
+	/** Clipboard transport: the archive as Base64 behind a short text prefix. */
+	FString EncodeToText(const TArray<FVolumeRecord>& Records);
+	bool IsEncodedText(const FString& Text);
+	bool DecodeFromText(const FString& Text, TArray<FVolumeRecord>& OutRecords);
+}
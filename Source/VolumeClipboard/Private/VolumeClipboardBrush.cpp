@@ -0,0 +1,117 @@
+#include "VolumeClipboardBrush.h"
+#include "VolumeClipboardGeometry.h"
+
+namespace VolumeClipboardBrush
+{
+	bool BuildBrushBsp(UModel* Model, bool bConvex, FBSPOps::EBspOptimization FallbackQuality)
+	{
+		check(Model && Model->Polys);
+
+		// Mirrors FBSPOps::csgPrepMovingBrush, with the bspBuild step swapped out for convex brushes
+		Model->EmptyModel(1, 0);
+		Model->BuildBound();
+
+		if (bConvex)
+		{
+			BuildConvexBsp(Model);
+		}
+		else
+		{
+			FBSPOps::bspBuild(Model, FallbackQuality, 15, 70, 1, 0);
+		}
+
+		FBSPOps::bspRefresh(Model, true);
+		FBSPOps::bspBuildBounds(Model);
+		return bConvex;
+	}
+
+	void BuildConvexBsp(UModel* Model)
+	{
+		TArray<FPoly>& Polys = Model->Polys->Element;
+
+		// Every poly of a convex solid is behind every other plane, so bspBuild would only ever put
+		// polys on the back side of a splitter: a single back chain, with coplanar polys sharing a node.
+		TArray<bool> Placed;
+		Placed.SetNumZeroed(Polys.Num());
+
+		int32 iParent = INDEX_NONE;
+		for (int32 i = 0; i < Polys.Num(); i++)
+		{
+			if (Placed[i]) continue;
+
+			FPoly& SplitPoly = Polys[i];
+			SplitPoly.iLink = Model->Surfs.Num();
+			const int32 iNode = FBSPOps::bspAddNode(Model, iParent, iParent == INDEX_NONE ? FBSPOps::NODE_Root : FBSPOps::NODE_Back, 0, &SplitPoly);
+			Placed[i] = true;
+
+			const FPlane SplitPlane(SplitPoly.Vertices[0], SplitPoly.Normal);
+			for (int32 j = i + 1; j < Polys.Num(); j++)
+			{
+				if (Placed[j]) continue;
+
+				FPoly& Other = Polys[j];
+				if (!FVector::Coincident(Other.Normal, SplitPoly.Normal)) continue;
+				if (FMath::Abs(SplitPlane.PlaneDot(Other.Vertices[0])) > THRESH_POINT_ON_PLANE) continue;
+
+				// Coplanar polys share the splitter's surface, as in SplitPolyList
+				Other.iLink = Model->Surfs.Num() - 1;
+				FBSPOps::bspAddNode(Model, iNode, FBSPOps::NODE_Plane, 0, &Other);
+				Placed[j] = true;
+			}
+
+			iParent = iNode;
+		}
+	}
+
+	bool FBspCache::Apply(UModel* Model, uint32 PolyHash)
+	{
+		NumLookups++;
+
+		TArray<FEntry*, TInlineAllocator<1>> Candidates;
+		Entries.MultiFindPointer(PolyHash, Candidates);
+
+		for (FEntry* Entry : Candidates)
+		{
+			if (!VolumeClipboardGeometry::PolysMatch(Entry->Polys, Model->Polys->Element)) continue;
+
+			// No per-element undo records: a reused model was already Modify()'d by the in-place update,
+			// a spawned one only exists inside the paste transaction
+			Model->EmptyModel(1, 0);
+			Model->Nodes.Append(Entry->Nodes);
+			Model->Surfs.Append(Entry->Surfs);
+			Model->Verts.Append(Entry->Verts);
+			Model->Points.Append(Entry->Points);
+			Model->Vectors.Append(Entry->Vectors);
+			Model->LeafHulls = Entry->LeafHulls;
+			Model->Leaves = Entry->Leaves;
+			Model->Bounds = Entry->Bounds;
+			Model->NumSharedSides = Entry->NumSharedSides;
+
+			// The build wrote each poly's surface index back, the match only compared flags and vertices
+			TArray<FPoly>& Polys = Model->Polys->Element;
+			for (int32 i = 0; i < Polys.Num(); i++)
+			{
+				Polys[i].iLink = Entry->Polys[i].iLink;
+			}
+
+			NumHits++;
+			return true;
+		}
+		return false;
+	}
+
+	void FBspCache::Store(const UModel* Model, uint32 PolyHash)
+	{
+		FEntry& Entry = Entries.Add(PolyHash, FEntry());
+		Entry.Polys = Model->Polys->Element;
+		Entry.Nodes = Model->Nodes;
+		Entry.Surfs = Model->Surfs;
+		Entry.Verts = Model->Verts;
+		Entry.Points = Model->Points;
+		Entry.Vectors = Model->Vectors;
+		Entry.LeafHulls = Model->LeafHulls;
+		Entry.Leaves = Model->Leaves;
+		Entry.Bounds = Model->Bounds;
+		Entry.NumSharedSides = Model->NumSharedSides;
+	}
+}
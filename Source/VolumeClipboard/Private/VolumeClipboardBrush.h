@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BSPOps.h"
+#include "Model.h"
+#include "Engine/Polys.h"
+
+// ---------------------------------------------------------
+// Brush BSP construction for pasted volumes.
+// Convex brushes (boxes, prisms, most cooked volumes) get their trivial
+// BSP built directly, everything else goes through FBSPOps::bspBuild.
+// ---------------------------------------------------------
+namespace VolumeClipboardBrush
+{
+	/**
+	 * Builds the brush BSP from Model->Polys, the same result csgPrepMovingBrush produces.
+	 * bConvex must come from VolumeClipboardGeometry::IsConvex on the same polys.
+	 * Returns true if the convex fast path was used.
+	 */
+	bool BuildBrushBsp(UModel* Model, bool bConvex, FBSPOps::EBspOptimization FallbackQuality);
+
+	/** Emits the BSP of a convex poly set: one node per plane, chained through the back (inside) children. */
+	void BuildConvexBsp(UModel* Model);
+
+	/**
+	 * Built BSP data keyed by brush shape. Identical brushes (same local polys) copy the
+	 * nodes, surfaces, points, collision hulls and the polys' surface links (iLink) of the
+	 * first one instead of building again.
+	 */
+	class FBspCache
+	{
+	public:
+		/** Copies cached BSP data into Model if its polys match an earlier build. Returns false on a miss. */
+		bool Apply(UModel* Model, uint32 PolyHash);
+
+		/** Remembers the BSP that was just built for Model (which must have been a miss). */
+		void Store(const UModel* Model, uint32 PolyHash);
+
+		int32 GetNumHits() const { return NumHits; }
+		int32 GetNumLookups() const { return NumLookups; }
+		int32 GetNumShapes() const { return Entries.Num(); }
+
+	private:
+		struct FEntry
+		{
+			TArray<FPoly> Polys;
+			TArray<FBspNode> Nodes;
+			TArray<FBspSurf> Surfs;
+			TArray<FVert> Verts;
+			TArray<FVector> Points;
+			TArray<FVector> Vectors;
+			TArray<int32> LeafHulls;
+			TArray<FLeaf> Leaves;
+			FBoxSphereBounds Bounds;
+			int32 NumSharedSides = 0;
+		};
+
+		TMultiMap<uint32, FEntry> Entries;
+		int32 NumHits = 0;
+		int32 NumLookups = 0;
+	};
+}
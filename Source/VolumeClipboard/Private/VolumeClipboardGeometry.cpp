@@ -0,0 +1,526 @@
+#include "VolumeClipboardGeometry.h"
+#include "Engine/Polys.h"
+#include "Model.h"
+
+namespace VolumeClipboardGeometry
+{
+	int32 WeldPoints(FVolumeRecord& Rec, float Tolerance)
+	{
+		check(Rec.bIndexed);
+		if (Tolerance <= 0.0f || Rec.Vertices.Num() < 2) return 0;
+
+		// Spatial hash: any match is at most one cell away as long as cells are at least Tolerance wide.
+		// The floor on the cell size keeps coordinates / CellSize inside int32 for world-sized maps.
+		const float CellSize = FMath::Max(Tolerance, 0.01f);
+		const float ToleranceSq = Tolerance * Tolerance;
+
+		TMap<FIntVector, TArray<int32, TInlineAllocator<2>>> Grid;
+		TArray<FVector> WeldedPoints;
+		TArray<int32> Remap;
+		Remap.SetNumUninitialized(Rec.Vertices.Num());
+
+		for (int32 PointIndex = 0; PointIndex < Rec.Vertices.Num(); PointIndex++)
+		{
+			const FVector& Point = Rec.Vertices[PointIndex];
+			const FIntVector Cell(FMath::FloorToInt(Point.X / CellSize), FMath::FloorToInt(Point.Y / CellSize), FMath::FloorToInt(Point.Z / CellSize));
+
+			int32 Match = INDEX_NONE;
+			for (int32 dx = -1; dx <= 1 && Match == INDEX_NONE; dx++)
+			{
+				for (int32 dy = -1; dy <= 1 && Match == INDEX_NONE; dy++)
+				{
+					for (int32 dz = -1; dz <= 1 && Match == INDEX_NONE; dz++)
+					{
+						if (const auto* Bucket = Grid.Find(Cell + FIntVector(dx, dy, dz)))
+						{
+							for (int32 Candidate : *Bucket)
+							{
+								if (FVector::DistSquared(WeldedPoints[Candidate], Point) <= ToleranceSq)
+								{
+									Match = Candidate;
+									break;
+								}
+							}
+						}
+					}
+				}
+			}
+
+			if (Match == INDEX_NONE)
+			{
+				Match = WeldedPoints.Add(Point);
+				Grid.FindOrAdd(Cell).Add(Match);
+			}
+			Remap[PointIndex] = Match;
+		}
+
+		const int32 NumRemoved = Rec.Vertices.Num() - WeldedPoints.Num();
+		if (NumRemoved == 0) return 0;
+
+		// Rewrite the index lists, welding can fold an edge so repeated corners are dropped
+		TArray<int32> NewIndices;
+		TArray<FVolumePolyRecord> NewPolys;
+		NewIndices.Reserve(Rec.Indices.Num());
+		NewPolys.Reserve(Rec.Polys.Num());
+
+		for (const FVolumePolyRecord& Poly : Rec.Polys)
+		{
+			FVolumePolyRecord NewPoly = Poly;
+			NewPoly.FirstVertex = NewIndices.Num();
+
+			for (int32 v = 0; v < Poly.NumVertices; v++)
+			{
+				const int32 Index = Remap[Rec.Indices[Poly.FirstVertex + v]];
+				if (NewIndices.Num() > NewPoly.FirstVertex && NewIndices.Last() == Index) continue;
+				NewIndices.Add(Index);
+			}
+			while (NewIndices.Num() - NewPoly.FirstVertex > 1 && NewIndices.Last() == NewIndices[NewPoly.FirstVertex])
+			{
+				NewIndices.Pop(false);
+			}
+
+			NewPoly.NumVertices = NewIndices.Num() - NewPoly.FirstVertex;
+			if (NewPoly.NumVertices < 3)
+			{
+				NewIndices.SetNum(NewPoly.FirstVertex, false);
+				continue;
+			}
+			NewPolys.Add(NewPoly);
+		}
+
+		Rec.Vertices = MoveTemp(WeldedPoints);
+		Rec.Indices = MoveTemp(NewIndices);
+		Rec.Polys = MoveTemp(NewPolys);
+		return NumRemoved;
+	}
+
+	// ---------------------------------------------------------
+	// HELPER: Poly loops used while simplifying an indexed record
+	// ---------------------------------------------------------
+	struct FMergeLoop
+	{
+		TArray<int32> Points;
+		uint32 Flags = 0;
+		FVector Normal = FVector::ZeroVector;
+		bool bRemoved = false;
+	};
+
+	/** Winding sum of FPoly::CalcNormal, its length is twice the loop area. */
+	static FVector GetLoopCross(const TArray<FVector>& Points, const TArray<int32>& Loop)
+	{
+		FVector Cross = FVector::ZeroVector;
+		for (int32 v = 2; v < Loop.Num(); v++)
+		{
+			Cross += (Points[Loop[v - 1]] - Points[Loop[0]]) ^ (Points[Loop[v]] - Points[Loop[0]]);
+		}
+		return Cross;
+	}
+
+	static int32 WrapIndex(int32 Index, int32 Num)
+	{
+		return (Index % Num + Num) % Num;
+	}
+
+	static uint64 MakeEdgeKey(int32 From, int32 To)
+	{
+		return ((uint64)(uint32)From << 32) | (uint32)To;
+	}
+
+	/** Distance of Current from the line Prev-Next, positive when the corner turns the same way as Normal (convex). */
+	static float GetCornerDistance(const FVector& Prev, const FVector& Current, const FVector& Next, const FVector& Normal)
+	{
+		return (((Current - Prev) ^ (Next - Current)) | Normal) / FMath::Max(FVector::Dist(Prev, Next), KINDA_SMALL_NUMBER);
+	}
+
+	/**
+	 * Joins B into A across the edge starting at A.Points[EdgeStart], extended to the whole run of edges the
+	 * two loops share. Fails if B does not hold that edge reversed or the result is not a convex face.
+	 * Corners within Tolerance of a straight line are kept here, so later merges still find shared edges.
+	 */
+	static bool TryMergeLoops(const TArray<FVector>& Points, const FMergeLoop& A, const FMergeLoop& B, int32 EdgeStart, float Tolerance, TArray<int32>& OutMerged)
+	{
+		if (A.Flags != B.Flags || (A.Normal | B.Normal) < 0.999f) return false;
+
+		const FPlane Plane(Points[A.Points[0]], A.Normal);
+		for (int32 Point : B.Points)
+		{
+			if (FMath::Abs(Plane.PlaneDot(Points[Point])) > Tolerance) return false;
+		}
+
+		const int32 NumA = A.Points.Num();
+		const int32 NumB = B.Points.Num();
+
+		// The edge map is only rebuilt once per pass, so the neighbour may have changed since
+		const int32 StartB = B.Points.Find(A.Points[EdgeStart]);
+		if (StartB == INDEX_NONE || B.Points[WrapIndex(StartB - 1, NumB)] != A.Points[WrapIndex(EdgeStart + 1, NumA)]) return false;
+
+		// Shared run is A[RunStart..RunEnd], stored in B in reverse from BStart down to BEnd
+		int32 RunStart = EdgeStart;
+		int32 RunEnd = EdgeStart + 1;
+		int32 BStart = StartB;
+		int32 BEnd = StartB - 1;
+		int32 RunLength = 1;
+		const int32 MaxRun = FMath::Min(NumA, NumB) - 1;
+		while (RunLength < MaxRun && A.Points[WrapIndex(RunEnd + 1, NumA)] == B.Points[WrapIndex(BEnd - 1, NumB)])
+		{
+			RunEnd++;
+			BEnd--;
+			RunLength++;
+		}
+		while (RunLength < MaxRun && A.Points[WrapIndex(RunStart - 1, NumA)] == B.Points[WrapIndex(BStart + 1, NumB)])
+		{
+			RunStart--;
+			BStart++;
+			RunLength++;
+		}
+
+		// A from the end of the run around to its start, then B's points off the run
+		OutMerged.Reset(NumA + NumB - 2 * RunLength);
+		for (int32 k = 0; k <= NumA - RunLength; k++)
+		{
+			OutMerged.Add(A.Points[WrapIndex(RunEnd + k, NumA)]);
+		}
+		for (int32 k = 1; k < NumB - RunLength; k++)
+		{
+			const int32 Point = B.Points[WrapIndex(BStart + k, NumB)];
+			if (OutMerged.Contains(Point)) return false;
+			OutMerged.Add(Point);
+		}
+
+		int32 NumCorners = 0;
+		for (int32 v = 0; v < OutMerged.Num(); v++)
+		{
+			const float Distance = GetCornerDistance(
+				Points[OutMerged[WrapIndex(v - 1, OutMerged.Num())]], Points[OutMerged[v]], Points[OutMerged[WrapIndex(v + 1, OutMerged.Num())]], A.Normal);
+			if (Distance < -Tolerance) return false;
+			if (Distance > Tolerance) NumCorners++;
+		}
+		return NumCorners >= 3 && NumCorners <= FBspNode::MAX_NODE_VERTICES;
+	}
+
+	/** Drops points that lie within Tolerance of the segment between their neighbours. */
+	static void RemoveCollinearPoints(const TArray<FVector>& Points, TArray<int32>& Loop, float Tolerance)
+	{
+		for (int32 v = 0; v < Loop.Num() && Loop.Num() > 3;)
+		{
+			const FVector& Prev = Points[Loop[WrapIndex(v - 1, Loop.Num())]];
+			const FVector& Next = Points[Loop[WrapIndex(v + 1, Loop.Num())]];
+			if (FMath::PointDistToSegment(Points[Loop[v]], Prev, Next) <= Tolerance)
+			{
+				Loop.RemoveAt(v, 1, false);
+			}
+			else
+			{
+				v++;
+			}
+		}
+	}
+
+	int32 SimplifyPolys(FVolumeRecord& Rec, float Tolerance)
+	{
+		check(Rec.bIndexed);
+		if (Rec.Polys.Num() < 2) return 0;
+
+		Tolerance = FMath::Max(Tolerance, (float)THRESH_POINT_ON_PLANE);
+
+		// 1. Loops, minus slivers (height over the longest edge below tolerance)
+		TArray<FMergeLoop> Loops;
+		Loops.Reserve(Rec.Polys.Num());
+		for (const FVolumePolyRecord& Poly : Rec.Polys)
+		{
+			FMergeLoop Loop;
+			Loop.Flags = Poly.Flags;
+			Loop.Points.Append(Rec.Indices.GetData() + Poly.FirstVertex, Poly.NumVertices);
+
+			float LongestEdge = 0.0f;
+			for (int32 v = 0; v < Loop.Points.Num(); v++)
+			{
+				LongestEdge = FMath::Max(LongestEdge, FVector::Dist(Rec.Vertices[Loop.Points[v]], Rec.Vertices[Loop.Points[(v + 1) % Loop.Points.Num()]]));
+			}
+
+			const FVector Cross = GetLoopCross(Rec.Vertices, Loop.Points);
+			if (LongestEdge <= 0.0f || Cross.Size() / LongestEdge < Tolerance) continue;
+
+			Loop.Normal = Cross.GetSafeNormal();
+			Loops.Add(MoveTemp(Loop));
+		}
+
+		// 2. Merge neighbours across shared edges until nothing changes.
+		// Edges moved into a merged loop are only found again on the next pass.
+		TMap<uint64, int32> EdgeOwners;
+		TArray<int32> Merged;
+		bool bMergedAny = true;
+		while (bMergedAny)
+		{
+			bMergedAny = false;
+
+			EdgeOwners.Reset();
+			for (int32 LoopIndex = 0; LoopIndex < Loops.Num(); LoopIndex++)
+			{
+				if (Loops[LoopIndex].bRemoved) continue;
+
+				const TArray<int32>& Points = Loops[LoopIndex].Points;
+				for (int32 v = 0; v < Points.Num(); v++)
+				{
+					EdgeOwners.Add(MakeEdgeKey(Points[v], Points[(v + 1) % Points.Num()]), LoopIndex);
+				}
+			}
+
+			for (int32 LoopIndex = 0; LoopIndex < Loops.Num(); LoopIndex++)
+			{
+				FMergeLoop& Loop = Loops[LoopIndex];
+				if (Loop.bRemoved) continue;
+
+				for (int32 v = 0; v < Loop.Points.Num(); v++)
+				{
+					const int32* Neighbour = EdgeOwners.Find(MakeEdgeKey(Loop.Points[(v + 1) % Loop.Points.Num()], Loop.Points[v]));
+					if (!Neighbour || *Neighbour == LoopIndex || Loops[*Neighbour].bRemoved) continue;
+
+					if (TryMergeLoops(Rec.Vertices, Loop, Loops[*Neighbour], v, Tolerance, Merged))
+					{
+						Loop.Points = Merged;
+						Loops[*Neighbour].bRemoved = true;
+						bMergedAny = true;
+						break;
+					}
+				}
+			}
+		}
+
+		// 3. Write back, keeping only points that are still referenced
+		FVolumeRecord Simplified;
+		Simplified.bIndexed = true;
+		TMap<int32, int32> PointRemap;
+		for (FMergeLoop& Loop : Loops)
+		{
+			if (Loop.bRemoved) continue;
+
+			RemoveCollinearPoints(Rec.Vertices, Loop.Points, Tolerance);
+
+			FVolumePolyRecord& Poly = Simplified.Polys.AddDefaulted_GetRef();
+			Poly.Flags = Loop.Flags;
+			Poly.FirstVertex = Simplified.Indices.Num();
+			Poly.NumVertices = Loop.Points.Num();
+
+			for (int32 Point : Loop.Points)
+			{
+				int32* NewIndex = PointRemap.Find(Point);
+				if (!NewIndex)
+				{
+					NewIndex = &PointRemap.Add(Point, Simplified.Vertices.Add(Rec.Vertices[Point]));
+				}
+				Simplified.Indices.Add(*NewIndex);
+			}
+		}
+
+		const int32 NumRemoved = Rec.Polys.Num() - Simplified.Polys.Num();
+		if (NumRemoved == 0) return 0;
+
+		// Sliver removal and collinear trimming stay within tolerance, anything bigger means a bad merge
+		const double VolumeBefore = ComputeVolume(Rec);
+		const double VolumeAfter = ComputeVolume(Simplified);
+		if (FMath::Abs(VolumeAfter - VolumeBefore) > VolumeBefore * 1e-3)
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("Simplifying %d polys changed the enclosed volume (%.1f -> %.1f), keeping the original polys."), Rec.Polys.Num(), VolumeBefore, VolumeAfter);
+			return 0;
+		}
+
+		Rec.Vertices = MoveTemp(Simplified.Vertices);
+		Rec.Indices = MoveTemp(Simplified.Indices);
+		Rec.Polys = MoveTemp(Simplified.Polys);
+		return NumRemoved;
+	}
+
+	double ComputeVolume(const FVolumeRecord& Rec)
+	{
+		// Sum of signed tetrahedra against the origin over a fan of every poly
+		double SixVolume = 0.0;
+		for (const FVolumePolyRecord& Poly : Rec.Polys)
+		{
+			if (Poly.NumVertices < 3) continue;
+
+			const FVector& V0 = Rec.GetPolyVertex(Poly, 0);
+			for (int32 v = 2; v < Poly.NumVertices; v++)
+			{
+				SixVolume += (double)(V0 | (Rec.GetPolyVertex(Poly, v - 1) ^ Rec.GetPolyVertex(Poly, v)));
+			}
+		}
+		return FMath::Abs(SixVolume) / 6.0;
+	}
+
+	void BuildPolys(const FVolumeRecord& Rec, TArray<FPoly>& OutPolys)
+	{
+		// Decoded parameters are untrusted, anything that is not a real box falls back to the (empty) poly pools
+		if (Rec.BuilderType == CubeBuilderType && Rec.BuilderParams.Num() == 3 &&
+			Rec.BuilderParams[0] > 0.0f && Rec.BuilderParams[1] > 0.0f && Rec.BuilderParams[2] > 0.0f)
+		{
+			BuildCubePolys(FVector(Rec.BuilderParams[0], Rec.BuilderParams[1], Rec.BuilderParams[2]), Rec.BuilderFlags, OutPolys);
+			return;
+		}
+
+		OutPolys.Reset(Rec.Polys.Num());
+
+		for (const FVolumePolyRecord& PolyRec : Rec.Polys)
+		{
+			FPoly NewPoly;
+			NewPoly.Init();
+			NewPoly.PolyFlags = PolyRec.Flags;
+			NewPoly.Vertices.Reserve(PolyRec.NumVertices);
+			for (int32 v = 0; v < PolyRec.NumVertices; v++)
+			{
+				NewPoly.Vertices.Add(Rec.GetPolyVertex(PolyRec, v));
+			}
+
+			// Fix() collapses coincident / collinear corners, anything left under 3 has no area.
+			// Finalize dereferences its owner for polys under 3 vertices, this check is what makes the null owner safe.
+			if (NewPoly.Vertices.Num() < 3 || NewPoly.Fix() < 3) continue;
+			NewPoly.Finalize(nullptr, 1);
+
+			NewPoly.Base = NewPoly.Vertices[0];
+			OutPolys.Add(MoveTemp(NewPoly));
+		}
+	}
+
+	bool DetectCube(const FVolumeRecord& Rec, float Tolerance, FVector& OutSize, uint32& OutFlags)
+	{
+		if (Rec.Polys.Num() < 6 || Rec.Vertices.Num() < 4) return false;
+
+		// UCubeBuilder centers the box on the pivot
+		const FBox Bounds(Rec.Vertices);
+		const FVector Half = Bounds.GetExtent();
+		if (!Bounds.GetCenter().IsNearlyZero(Tolerance) || Half.GetMin() <= Tolerance) return false;
+
+		// Face index = Axis * 2 + (Side > 0), accumulated poly area per face
+		double FaceArea[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+		OutFlags = Rec.Polys[0].Flags;
+
+		for (const FVolumePolyRecord& Poly : Rec.Polys)
+		{
+			if (Poly.Flags != OutFlags || Poly.NumVertices < 3) return false;
+
+			int32 Face = INDEX_NONE;
+			for (int32 Candidate = 0; Candidate < 6 && Face == INDEX_NONE; Candidate++)
+			{
+				const int32 Axis = Candidate / 2;
+				const float Plane = (Candidate & 1) ? Half[Axis] : -Half[Axis];
+
+				bool bOnPlane = true;
+				for (int32 v = 0; v < Poly.NumVertices && bOnPlane; v++)
+				{
+					bOnPlane = FMath::Abs(Rec.GetPolyVertex(Poly, v)[Axis] - Plane) <= Tolerance;
+				}
+				if (bOnPlane) Face = Candidate;
+			}
+			if (Face == INDEX_NONE) return false;
+
+			// Same winding sum as FPoly::CalcNormal, so the sign also tells whether the poly faces outward
+			const FVector& V0 = Rec.GetPolyVertex(Poly, 0);
+			FVector Cross = FVector::ZeroVector;
+			for (int32 v = 2; v < Poly.NumVertices; v++)
+			{
+				Cross += (Rec.GetPolyVertex(Poly, v - 1) - V0) ^ (Rec.GetPolyVertex(Poly, v) - V0);
+			}
+
+			const int32 Axis = Face / 2;
+			const float Outward = (Face & 1) ? Cross[Axis] : -Cross[Axis];
+			if (Outward <= 0.0f) return false;
+			FaceArea[Face] += 0.5 * Cross.Size();
+		}
+
+		// Every face has to be covered exactly once, gaps or overlapping polys change the sum
+		for (int32 Face = 0; Face < 6; Face++)
+		{
+			const int32 Axis = Face / 2;
+			const double Expected = 4.0 * Half[(Axis + 1) % 3] * Half[(Axis + 2) % 3];
+			if (FMath::Abs(FaceArea[Face] - Expected) > Expected * 1e-3) return false;
+		}
+
+		OutSize = Half * 2.0f;
+		return true;
+	}
+
+	void BuildCubePolys(const FVector& Size, uint32 Flags, TArray<FPoly>& OutPolys)
+	{
+		static const float Corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+
+		const FVector Half = Size * 0.5f;
+		OutPolys.Reset(6);
+
+		for (int32 Face = 0; Face < 6; Face++)
+		{
+			const int32 Axis = Face / 2;
+			const int32 AxisU = (Axis + 1) % 3;
+			const int32 AxisV = (Axis + 2) % 3;
+			const float Side = (Face & 1) ? 1.0f : -1.0f;
+
+			FPoly NewPoly;
+			NewPoly.Init();
+			NewPoly.PolyFlags = Flags;
+			for (const float* Corner : Corners)
+			{
+				FVector Vertex;
+				Vertex[Axis] = Side * Half[Axis];
+				Vertex[AxisU] = Corner[0] * Half[AxisU];
+				Vertex[AxisV] = Corner[1] * Half[AxisV];
+				NewPoly.Vertices.Add(Vertex);
+			}
+
+			// Finalize dereferences its owner for polys under 3 vertices, rejecting those keeps the null owner safe
+			if (NewPoly.Fix() < 3) continue;
+			NewPoly.Finalize(nullptr, 1);
+
+			NewPoly.Base = NewPoly.Vertices[0];
+			if (NewPoly.Normal[Axis] * Side < 0.0f)
+			{
+				NewPoly.Reverse();
+			}
+			OutPolys.Add(MoveTemp(NewPoly));
+		}
+	}
+
+	bool IsConvex(const TArray<FPoly>& Polys)
+	{
+		if (Polys.Num() < 4) return false;
+
+		for (const FPoly& PlanePoly : Polys)
+		{
+			if (PlanePoly.Normal.IsNearlyZero()) return false;
+
+			const FPlane Plane(PlanePoly.Vertices[0], PlanePoly.Normal);
+			for (const FPoly& Other : Polys)
+			{
+				for (const FVector& Vertex : Other.Vertices)
+				{
+					if (Plane.PlaneDot(Vertex) > THRESH_POINT_ON_PLANE) return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	uint32 HashPolys(const TArray<FPoly>& Polys)
+	{
+		const int32 NumPolys = Polys.Num();
+		uint32 Hash = FCrc::MemCrc32(&NumPolys, sizeof(NumPolys));
+		for (const FPoly& Poly : Polys)
+		{
+			const int32 NumVertices = Poly.Vertices.Num();
+			Hash = FCrc::MemCrc32(&Poly.PolyFlags, sizeof(Poly.PolyFlags), Hash);
+			Hash = FCrc::MemCrc32(&NumVertices, sizeof(NumVertices), Hash);
+			Hash = FCrc::MemCrc32(Poly.Vertices.GetData(), NumVertices * sizeof(FVector), Hash);
+		}
+		return Hash;
+	}
+
+	bool PolysMatch(const TArray<FPoly>& A, const TArray<FPoly>& B)
+	{
+		if (A.Num() != B.Num()) return false;
+
+		for (int32 i = 0; i < A.Num(); i++)
+		{
+			if (A[i].PolyFlags != B[i].PolyFlags || A[i].Vertices.Num() != B[i].Vertices.Num()) return false;
+			if (FMemory::Memcmp(A[i].Vertices.GetData(), B[i].Vertices.GetData(), A[i].Vertices.Num() * sizeof(FVector)) != 0) return false;
+		}
+		return true;
+	}
+}
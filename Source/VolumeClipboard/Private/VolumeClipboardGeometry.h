@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VolumeClipboardTypes.h"
+
+class FPoly;
+
+// ---------------------------------------------------------
+// Geometry helpers working on plain records (no UObjects).
+// ---------------------------------------------------------
+namespace VolumeClipboardGeometry
+{
+	/** BuilderType written for every brush that is exported as raw polys. */
+	static const TCHAR* const CustomPolysBuilderType = TEXT("CustomPolys");
+
+	/** BuilderType of brushes exported as UCubeBuilder parameters. */
+	static const TCHAR* const CubeBuilderType = TEXT("Cube");
+
+	/**
+	 * Merges points of an indexed record that are within Tolerance of each other,
+	 * then drops repeated corners and polys that collapse below 3 vertices.
+	 * Returns the number of points removed.
+	 */
+	int32 WeldPoints(FVolumeRecord& Rec, float Tolerance);
+
+	/**
+	 * Cleans up BSP fragments of an indexed record: drops slivers thinner than Tolerance and merges
+	 * adjacent coplanar polys with identical flags as long as the result stays convex.
+	 * The record is left untouched if the enclosed volume would change. Returns the number of polys removed.
+	 */
+	int32 SimplifyPolys(FVolumeRecord& Rec, float Tolerance);
+
+	/** Volume enclosed by the record's polys (closed, consistently wound shells). */
+	double ComputeVolume(const FVolumeRecord& Rec);
+
+	/**
+	 * Builds finalized brush polys (normal, texture axes) from a record. Degenerate polys are dropped.
+	 * Builder records are expanded from their parameters. Touches no UObjects, so it is safe to run on worker threads.
+	 */
+	void BuildPolys(const FVolumeRecord& Rec, TArray<FPoly>& OutPolys);
+
+	/**
+	 * True if the record's polys exactly cover the faces of a box centered on the pivot, which is what
+	 * UCubeBuilder produces for a solid cube. Split and triangulated faces are accepted, all polys must share their flags.
+	 */
+	bool DetectCube(const FVolumeRecord& Rec, float Tolerance, FVector& OutSize, uint32& OutFlags);
+
+	/** Same six faces UCubeBuilder builds for a solid, untessellated cube, finalized with outward normals. */
+	void BuildCubePolys(const FVector& Size, uint32 Flags, TArray<FPoly>& OutPolys);
+
+	/** True if every vertex lies on or behind every poly plane, i.e. the polys bound a convex solid with outward normals. */
+	bool IsConvex(const TArray<FPoly>& Polys);
+
+	/** Content hash of a poly set (flags, vertex counts and positions). Equal shapes in local space hash equally. */
+	uint32 HashPolys(const TArray<FPoly>& Polys);
+
+	/** Exact comparison backing HashPolys, used to rule out collisions. */
+	bool PolysMatch(const TArray<FPoly>& A, const TArray<FPoly>& B);
+}
@@ -0,0 +1,399 @@
+#include "VolumeClipboardJson.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/BufferReader.h"
+#include "Engine/Polys.h"
+
+namespace VolumeClipboardJson
+{
+	FString BytesToString(const TArray<uint8>& Bytes)
+	{
+		return FString(Bytes.Num() / sizeof(TCHAR), reinterpret_cast<const TCHAR*>(Bytes.GetData()));
+	}
+
+	// ---------------------------------------------------------
+	// Token-stream decoder.
+	// Walks TJsonReader notation events and fills FVolumeRecords directly,
+	// unknown fields are skipped so newer payloads still paste.
+	// ---------------------------------------------------------
+	template <class CharType>
+	class TVolumeRecordReader
+	{
+	public:
+		explicit TVolumeRecordReader(FArchive& Stream)
+			: Reader(TJsonReaderFactory<CharType>::Create(&Stream))
+		{
+		}
+
+		bool ReadAll(TArray<FVolumeRecord>& OutRecords)
+		{
+			EJsonNotation Notation;
+			if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ArrayStart)
+			{
+				return Fail(TEXT("expected a top level array"));
+			}
+
+			while (Reader->ReadNext(Notation))
+			{
+				switch (Notation)
+				{
+				case EJsonNotation::ArrayEnd:
+					return true;
+				case EJsonNotation::ObjectStart:
+					if (!ReadVolume(OutRecords.AddDefaulted_GetRef())) return false;
+					if (!OutRecords.Last().HasValidGeometry()) return Fail(TEXT("poly references a vertex that does not exist"));
+					break;
+				case EJsonNotation::ArrayStart:
+					if (!Reader->SkipArray()) return Fail(TEXT("malformed array"));
+					break;
+				default:
+					break;
+				}
+			}
+			return Fail(TEXT("unexpected end of data"));
+		}
+
+	private:
+		bool Fail(const TCHAR* What)
+		{
+			UE_LOG(LogVolumeClipboard, Warning, TEXT("Volume JSON parse failed: %s %s"), What, *Reader->GetErrorMessage());
+			return false;
+		}
+
+		bool Skip(EJsonNotation Notation)
+		{
+			if (Notation == EJsonNotation::ObjectStart) return Reader->SkipObject();
+			if (Notation == EJsonNotation::ArrayStart) return Reader->SkipArray();
+			return Notation != EJsonNotation::Error;
+		}
+
+		/** Current scalar token as text (FJsonValue::AsString semantics). */
+		FString ScalarAsString(EJsonNotation Notation) const
+		{
+			switch (Notation)
+			{
+			case EJsonNotation::String:		return Reader->GetValueAsString();
+			case EJsonNotation::Number:		return FString::SanitizeFloat(Reader->GetValueAsNumber(), 0);
+			case EJsonNotation::Boolean:	return Reader->GetValueAsBoolean() ? TEXT("true") : TEXT("false");
+			default:						return FString();
+			}
+		}
+
+		/** Current scalar token as a number, accepting numeric strings like the string-encoded transform. */
+		double ScalarAsNumber(EJsonNotation Notation) const
+		{
+			if (Notation == EJsonNotation::Number) return Reader->GetValueAsNumber();
+			if (Notation == EJsonNotation::String) return FCString::Atod(*Reader->GetValueAsString());
+			return 0.0;
+		}
+
+		bool ReadProps(TArray<FVolumePropertyRecord>& OutProps)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ObjectEnd) return true;
+
+				if (Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart)
+				{
+					if (!Skip(Notation)) return Fail(TEXT("malformed property value"));
+					continue;
+				}
+
+				FVolumePropertyRecord& Prop = OutProps.AddDefaulted_GetRef();
+				Prop.Name = Reader->GetIdentifier();
+				Prop.Value = ScalarAsString(Notation);
+			}
+			return Fail(TEXT("unterminated property object"));
+		}
+
+		bool ReadStreamLinks(TArray<FVolumeStreamLinkRecord>& OutLinks)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd) return true;
+				if (Notation != EJsonNotation::ObjectStart)
+				{
+					if (!Skip(Notation)) return Fail(TEXT("malformed StreamLinks"));
+					continue;
+				}
+
+				FVolumeStreamLinkRecord& Link = OutLinks.AddDefaulted_GetRef();
+				while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+				{
+					const FString& Identifier = Reader->GetIdentifier();
+					if (Identifier == TEXT("Package")) Link.Package = ScalarAsString(Notation);
+					else if (Identifier == TEXT("Slot")) Link.Slot = (int32)ScalarAsNumber(Notation);
+					else if (!Skip(Notation)) return Fail(TEXT("malformed StreamLinks"));
+				}
+				if (Notation != EJsonNotation::ObjectEnd) return Fail(TEXT("unterminated StreamLinks entry"));
+			}
+			return Fail(TEXT("unterminated StreamLinks"));
+		}
+
+		bool ReadComponents(TArray<FVolumeComponentRecord>& OutComponents)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd) return true;
+				if (Notation != EJsonNotation::ObjectStart)
+				{
+					if (!Skip(Notation)) return Fail(TEXT("malformed Components"));
+					continue;
+				}
+
+				FVolumeComponentRecord Comp;
+				bool bHasProps = false;
+				while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+				{
+					const FString& Identifier = Reader->GetIdentifier();
+					if (Identifier == TEXT("ClassName"))
+					{
+						Comp.ClassName = ScalarAsString(Notation);
+					}
+					else if (Identifier == TEXT("Props") && Notation == EJsonNotation::ObjectStart)
+					{
+						if (!ReadProps(Comp.Props)) return false;
+						bHasProps = true;
+					}
+					else if (!Skip(Notation))
+					{
+						return Fail(TEXT("malformed component"));
+					}
+				}
+				if (Notation != EJsonNotation::ObjectEnd) return Fail(TEXT("unterminated component"));
+
+				// Components without a Props object carry nothing to restore
+				if (bHasProps)
+				{
+					OutComponents.Add(MoveTemp(Comp));
+				}
+			}
+			return Fail(TEXT("unterminated Components"));
+		}
+
+		bool ReadVerts(TArray<FVector>& OutVertices)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd) return true;
+				if (Notation != EJsonNotation::ObjectStart)
+				{
+					if (!Skip(Notation)) return Fail(TEXT("malformed Verts"));
+					continue;
+				}
+
+				FVector Vertex = FVector::ZeroVector;
+				while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+				{
+					const FString& Identifier = Reader->GetIdentifier();
+					if (Identifier == TEXT("X")) Vertex.X = ScalarAsNumber(Notation);
+					else if (Identifier == TEXT("Y")) Vertex.Y = ScalarAsNumber(Notation);
+					else if (Identifier == TEXT("Z")) Vertex.Z = ScalarAsNumber(Notation);
+					else if (!Skip(Notation)) return Fail(TEXT("malformed vertex"));
+				}
+				if (Notation != EJsonNotation::ObjectEnd) return Fail(TEXT("unterminated vertex"));
+
+				OutVertices.Add(Vertex);
+			}
+			return Fail(TEXT("unterminated Verts"));
+		}
+
+		bool ReadIndices(TArray<int32>& OutIndices)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd) return true;
+				if (Notation != EJsonNotation::Number) return Fail(TEXT("malformed Indices"));
+				OutIndices.Add((int32)Reader->GetValueAsNumber());
+			}
+			return Fail(TEXT("unterminated Indices"));
+		}
+
+		bool ReadParams(TArray<float>& OutParams)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd) return true;
+				if (Notation != EJsonNotation::Number && Notation != EJsonNotation::String) return Fail(TEXT("malformed BuilderParams"));
+				OutParams.Add((float)ScalarAsNumber(Notation));
+			}
+			return Fail(TEXT("unterminated BuilderParams"));
+		}
+
+		bool ReadPolys(FVolumeRecord& Rec)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ArrayEnd) return true;
+				if (Notation != EJsonNotation::ObjectStart)
+				{
+					if (!Skip(Notation)) return Fail(TEXT("malformed RawPolys"));
+					continue;
+				}
+
+				// Points precede RawPolys, so the record already knows which pool the ranges refer to
+				FVolumePolyRecord& Poly = Rec.Polys.AddDefaulted_GetRef();
+				Poly.Flags = PF_NotSolid;
+				Poly.FirstVertex = Rec.bIndexed ? Rec.Indices.Num() : Rec.Vertices.Num();
+
+				while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd)
+				{
+					const FString& Identifier = Reader->GetIdentifier();
+					if (Identifier == TEXT("Flags"))
+					{
+						Poly.Flags = (uint32)ScalarAsNumber(Notation);
+					}
+					else if (Identifier == TEXT("Verts") && Notation == EJsonNotation::ArrayStart)
+					{
+						const int32 FirstNewVertex = Rec.Vertices.Num();
+						if (!ReadVerts(Rec.Vertices)) return false;
+
+						// Inline vertices inside an indexed record become new points
+						if (Rec.bIndexed)
+						{
+							for (int32 i = FirstNewVertex; i < Rec.Vertices.Num(); i++)
+							{
+								Rec.Indices.Add(i);
+							}
+						}
+					}
+					else if (Identifier == TEXT("Indices") && Notation == EJsonNotation::ArrayStart)
+					{
+						if (!ReadIndices(Rec.Indices)) return false;
+					}
+					else if (!Skip(Notation))
+					{
+						return Fail(TEXT("malformed poly"));
+					}
+				}
+				if (Notation != EJsonNotation::ObjectEnd) return Fail(TEXT("unterminated poly"));
+
+				Poly.NumVertices = (Rec.bIndexed ? Rec.Indices.Num() : Rec.Vertices.Num()) - Poly.FirstVertex;
+			}
+			return Fail(TEXT("unterminated RawPolys"));
+		}
+
+		bool ReadVolume(FVolumeRecord& Rec)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ObjectEnd) return true;
+
+				const FString& Identifier = Reader->GetIdentifier();
+
+				if (Notation == EJsonNotation::ArrayStart)
+				{
+					bool bOk = true;
+					if (Identifier == TEXT("StreamLinks"))
+					{
+						Rec.bHasStreamLinks = true;
+						bOk = ReadStreamLinks(Rec.StreamLinks);
+					}
+					else if (Identifier == TEXT("Components"))
+					{
+						bOk = ReadComponents(Rec.Components);
+					}
+					else if (Identifier == TEXT("Points"))
+					{
+						Rec.bIndexed = true;
+						bOk = ReadVerts(Rec.Vertices);
+					}
+					else if (Identifier == TEXT("RawPolys"))
+					{
+						Rec.bHasModel = true;
+						bOk = ReadPolys(Rec);
+					}
+					else if (Identifier == TEXT("BuilderParams"))
+					{
+						bOk = ReadParams(Rec.BuilderParams);
+					}
+					else
+					{
+						bOk = Reader->SkipArray();
+					}
+					if (!bOk) return false;
+				}
+				else if (Notation == EJsonNotation::ObjectStart)
+				{
+					if (Identifier == TEXT("Properties"))
+					{
+						if (!ReadProps(Rec.Properties)) return false;
+					}
+					else if (!Reader->SkipObject())
+					{
+						return Fail(TEXT("malformed object"));
+					}
+				}
+				else if (Notation == EJsonNotation::Error)
+				{
+					return Fail(TEXT("invalid token"));
+				}
+				else if (Identifier == TEXT("Class")) Rec.Class = ScalarAsString(Notation);
+				else if (Identifier == TEXT("InternalName")) Rec.InternalName = ScalarAsString(Notation);
+				else if (Identifier == TEXT("OriginLevel"))
+				{
+					Rec.bHasOrigin = true;
+					Rec.OriginLevel = ScalarAsString(Notation);
+				}
+				else if (Identifier == TEXT("OriginLevelPackage")) Rec.OriginLevelPackage = ScalarAsString(Notation);
+				else if (Identifier == TEXT("LocX")) Rec.Location.X = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("LocY")) Rec.Location.Y = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("LocZ")) Rec.Location.Z = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("QuatX")) Rec.Rotation.X = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("QuatY")) Rec.Rotation.Y = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("QuatZ")) Rec.Rotation.Z = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("QuatW"))
+				{
+					Rec.bHasRotation = true;
+					Rec.Rotation.W = ScalarAsNumber(Notation);
+				}
+				else if (Identifier == TEXT("SclX")) Rec.Scale.X = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("SclY")) Rec.Scale.Y = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("SclZ")) Rec.Scale.Z = ScalarAsNumber(Notation);
+				else if (Identifier == TEXT("SpawnMethod"))
+				{
+					Rec.bHasSpawnMethod = true;
+					Rec.SpawnMethod = (int32)ScalarAsNumber(Notation);
+				}
+				else if (Identifier == TEXT("Mobility"))
+				{
+					Rec.bHasMobility = true;
+					Rec.Mobility = (int32)ScalarAsNumber(Notation);
+				}
+				else if (Identifier == TEXT("BrushType"))
+				{
+					Rec.bHasBrushType = true;
+					Rec.BrushType = (int32)ScalarAsNumber(Notation);
+				}
+				else if (Identifier == TEXT("BuilderType")) Rec.BuilderType = ScalarAsString(Notation);
+				else if (Identifier == TEXT("BuilderFlags")) Rec.BuilderFlags = (uint32)ScalarAsNumber(Notation);
+			}
+			return Fail(TEXT("unterminated volume object"));
+		}
+
+		TSharedRef<TJsonReader<CharType>> Reader;
+	};
+
+	template <class CharType>
+	bool DecodeStream(FArchive& Stream, TArray<FVolumeRecord>& OutRecords)
+	{
+		TVolumeRecordReader<CharType> RecordReader(Stream);
+		return RecordReader.ReadAll(OutRecords);
+	}
+
+	template bool DecodeStream<TCHAR>(FArchive& Stream, TArray<FVolumeRecord>& OutRecords);
+
+	bool Decode(const FString& Text, TArray<FVolumeRecord>& OutRecords)
+	{
+		// Read the string's own buffer in place instead of letting TJsonStringReader copy it
+		FBufferReader Stream((void*)*Text, Text.Len() * sizeof(TCHAR), false);
+		return DecodeStream<TCHAR>(Stream, OutRecords);
+	}
+}
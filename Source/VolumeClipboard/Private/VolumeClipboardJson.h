@@ -0,0 +1,213 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "VolumeClipboardTypes.h"
+
+// ---------------------------------------------------------
+// JSON volume format (debug / interop).
+// Schema is the original clipboard layout: one object per volume with
+// string-encoded transform, Properties, Components and RawPolys.
+// ---------------------------------------------------------
+namespace VolumeClipboardJson
+{
+	bool Decode(const FString& Text, TArray<FVolumeRecord>& OutRecords);
+
+	/** Decodes a JSON volume array by walking reader tokens, no DOM is built. */
+	template <class CharType>
+	bool DecodeStream(FArchive& Stream, TArray<FVolumeRecord>& OutRecords);
+
+	/** Reinterprets the bytes of a TCHAR JSON stream as a string. */
+	FString BytesToString(const TArray<uint8>& Bytes);
+
+	/**
+	 * Writes one volume object through the writer. The call sequence matches what
+	 * FJsonSerializer emits for the equivalent FJsonObject, so output is byte-identical.
+	 */
+	template <class CharType, class PrintPolicy>
+	void WriteVolume(TJsonWriter<CharType, PrintPolicy>& Writer, const FVolumeRecord& Rec)
+	{
+		auto WriteString = [&Writer](const TCHAR* Identifier, const FString& Value)
+		{
+			Writer.WriteValue(Identifier, Value);
+		};
+		auto WritePrecise = [&Writer](const TCHAR* Identifier, double Value)
+		{
+			Writer.WriteValue(Identifier, FString::Printf(TEXT("%.17g"), Value));
+		};
+		auto WriteProps = [&Writer](const TCHAR* Identifier, const TArray<FVolumePropertyRecord>& Props)
+		{
+			Writer.WriteObjectStart(Identifier);
+			for (const FVolumePropertyRecord& Prop : Props)
+			{
+				if (Prop.Encoding == EVolumePropertyEncoding::Text)
+				{
+					Writer.WriteValue(Prop.Name, Prop.Value);
+				}
+				else
+				{
+					Writer.WriteValue(Prop.Name, Prop.GetValueText());
+				}
+			}
+			Writer.WriteObjectEnd();
+		};
+
+		Writer.WriteObjectStart();
+
+		WriteString(TEXT("Class"), Rec.Class);
+		WriteString(TEXT("InternalName"), Rec.InternalName);
+
+		if (Rec.bHasOrigin)
+		{
+			WriteString(TEXT("OriginLevel"), Rec.OriginLevel);
+			WriteString(TEXT("OriginLevelPackage"), Rec.OriginLevelPackage);
+		}
+
+		if (Rec.bHasStreamLinks)
+		{
+			Writer.WriteArrayStart(TEXT("StreamLinks"));
+			for (const FVolumeStreamLinkRecord& Link : Rec.StreamLinks)
+			{
+				Writer.WriteObjectStart();
+				WriteString(TEXT("Package"), Link.Package);
+				Writer.WriteValue(TEXT("Slot"), (double)Link.Slot);
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+		}
+
+		WritePrecise(TEXT("LocX"), Rec.Location.X);
+		WritePrecise(TEXT("LocY"), Rec.Location.Y);
+		WritePrecise(TEXT("LocZ"), Rec.Location.Z);
+
+		if (Rec.bHasRotation)
+		{
+			WritePrecise(TEXT("QuatX"), Rec.Rotation.X);
+			WritePrecise(TEXT("QuatY"), Rec.Rotation.Y);
+			WritePrecise(TEXT("QuatZ"), Rec.Rotation.Z);
+			WritePrecise(TEXT("QuatW"), Rec.Rotation.W);
+		}
+
+		WritePrecise(TEXT("SclX"), Rec.Scale.X);
+		WritePrecise(TEXT("SclY"), Rec.Scale.Y);
+		WritePrecise(TEXT("SclZ"), Rec.Scale.Z);
+
+		if (Rec.bHasSpawnMethod) Writer.WriteValue(TEXT("SpawnMethod"), (double)Rec.SpawnMethod);
+		if (Rec.bHasMobility) Writer.WriteValue(TEXT("Mobility"), (double)Rec.Mobility);
+		if (Rec.bHasBrushType) Writer.WriteValue(TEXT("BrushType"), (double)Rec.BrushType);
+
+		WriteProps(TEXT("Properties"), Rec.Properties);
+
+		Writer.WriteArrayStart(TEXT("Components"));
+		for (const FVolumeComponentRecord& Comp : Rec.Components)
+		{
+			Writer.WriteObjectStart();
+			WriteString(TEXT("ClassName"), Comp.ClassName);
+			WriteProps(TEXT("Props"), Comp.Props);
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+
+		if (Rec.bHasModel)
+		{
+			auto WriteVertex = [&Writer](const FVector& V)
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("X"), (double)V.X);
+				Writer.WriteValue(TEXT("Y"), (double)V.Y);
+				Writer.WriteValue(TEXT("Z"), (double)V.Z);
+				Writer.WriteObjectEnd();
+			};
+
+			// Indexed records write each point once, polys then carry index lists instead of vertex copies
+			if (Rec.bIndexed)
+			{
+				Writer.WriteArrayStart(TEXT("Points"));
+				for (const FVector& V : Rec.Vertices)
+				{
+					WriteVertex(V);
+				}
+				Writer.WriteArrayEnd();
+			}
+
+			Writer.WriteArrayStart(TEXT("RawPolys"));
+			for (const FVolumePolyRecord& Poly : Rec.Polys)
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("Flags"), (double)Poly.Flags);
+
+				if (Rec.bIndexed)
+				{
+					Writer.WriteArrayStart(TEXT("Indices"));
+					for (int32 v = 0; v < Poly.NumVertices; v++)
+					{
+						Writer.WriteValue((double)Rec.Indices[Poly.FirstVertex + v]);
+					}
+					Writer.WriteArrayEnd();
+				}
+				else
+				{
+					Writer.WriteArrayStart(TEXT("Verts"));
+					for (int32 v = 0; v < Poly.NumVertices; v++)
+					{
+						WriteVertex(Rec.Vertices[Poly.FirstVertex + v]);
+					}
+					Writer.WriteArrayEnd();
+				}
+
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+		}
+
+		WriteString(TEXT("BuilderType"), Rec.BuilderType);
+
+		if (Rec.BuilderParams.Num() > 0)
+		{
+			Writer.WriteArrayStart(TEXT("BuilderParams"));
+			for (float Param : Rec.BuilderParams)
+			{
+				Writer.WriteValue((double)Param);
+			}
+			Writer.WriteArrayEnd();
+			Writer.WriteValue(TEXT("BuilderFlags"), (double)Rec.BuilderFlags);
+		}
+
+		Writer.WriteObjectEnd();
+	}
+
+	/** Streams a JSON volume array into an archive one record at a time, without building a DOM. */
+	template <class CharType = TCHAR>
+	class TVolumeStreamWriter
+	{
+	public:
+		explicit TVolumeStreamWriter(FArchive* InStream)
+			: Stream(InStream)
+			, Writer(TJsonWriterFactory<CharType>::Create(InStream))
+		{
+			Writer->WriteArrayStart();
+		}
+
+		void Write(const FVolumeRecord& Rec)
+		{
+			WriteVolume(*Writer, Rec);
+		}
+
+		bool Close()
+		{
+			Writer->WriteArrayEnd();
+			return Writer->Close();
+		}
+
+		/** Bytes written to the stream so far. */
+		int64 Tell() const
+		{
+			return Stream->Tell();
+		}
+
+	private:
+		FArchive* Stream;
+		TSharedRef<TJsonWriter<CharType>> Writer;
+	};
+}
@@ -0,0 +1,336 @@
+#include "VolumeClipboardProperties.h"
+#include "VolumeClipboardTypes.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/EnumProperty.h"
+#include "Engine/LevelStreamingVolume.h"
+#include "Engine/PostProcessVolume.h"
+#include "Editor.h"
+
+namespace VolumeClipboardProperties
+{
+	// Properties that are handled explicitly (transform, brush) or must never travel between actors
+	static const TSet<FName>& GetExcludedNames()
+	{
+		static const TSet<FName> ExcludedNames =
+		{
+			TEXT("Brush"), TEXT("BrushComponent"), TEXT("RootComponent"),
+			TEXT("Model"), TEXT("BrushBuilder"), TEXT("ActorLabel"),
+			TEXT("Owner"), TEXT("Instigator"), TEXT("SavedSelections"),
+			TEXT("RelativeLocation"), TEXT("RelativeRotation"), TEXT("RelativeScale3D"),
+			TEXT("Rotation"), TEXT("Location"), TEXT("PhysicsTransform"),
+			TEXT("ReplicatedMovement"), TEXT("SpriteScale"), TEXT("PivotOffset"),
+			TEXT("PrePivot"), TEXT("Tags"), TEXT("Layers"), TEXT("InputPriority")
+		};
+		return ExcludedNames;
+	}
+
+	struct FClassPropertyPlan
+	{
+		// Exported in this order
+		TArray<FCopyableProperty> Copyable;
+
+		// Serialized name -> property accepted on paste
+		TMap<FName, FProperty*> Restorable;
+	};
+
+	// Keyed weakly so a class that was garbage collected or replaced never matches a stale plan
+	static TMap<TWeakObjectPtr<const UClass>, TUniquePtr<FClassPropertyPlan>> PlanCache;
+
+	static FDelegateHandle ObjectsReplacedHandle;
+	static FDelegateHandle BlueprintCompiledHandle;
+
+	bool IsPropertySafeToCopy(const FProperty* Property)
+	{
+		const FName Name = Property->GetFName();
+		if (GetExcludedNames().Contains(Name))
+		{
+			return false;
+		}
+
+		// Pattern exclusions still need the string form, but only while a plan is built
+		const FString NameString = Name.ToString();
+		if (NameString.Contains(TEXT("Guid")) || NameString.Contains(TEXT("Cookie")) || NameString.StartsWith(TEXT("bHidden")))
+		{
+			return false;
+		}
+
+		if (Property->IsA(FNumericProperty::StaticClass())) return true;
+		if (Property->IsA(FBoolProperty::StaticClass())) return true;
+		if (Property->IsA(FStrProperty::StaticClass())) return true;
+		if (Property->IsA(FNameProperty::StaticClass())) return true;
+		if (Property->IsA(FTextProperty::StaticClass())) return true;
+		if (Property->IsA(FEnumProperty::StaticClass())) return true;
+		if (Property->IsA(FStructProperty::StaticClass())) return true;
+		if (Property->IsA(FArrayProperty::StaticClass())) return true;
+		if (Property->IsA(FObjectPropertyBase::StaticClass())) return true;
+		if (Property->IsA(FInterfaceProperty::StaticClass())) return true;
+
+		return false;
+	}
+
+	static const FClassPropertyPlan& GetPlan(const UClass* Class)
+	{
+		check(Class);
+
+		// GEditor does not exist yet when the module starts up, hook recompiles on first use instead
+		if (!BlueprintCompiledHandle.IsValid() && GEditor)
+		{
+			BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&ResetCache);
+		}
+
+		if (const TUniquePtr<FClassPropertyPlan>* Cached = PlanCache.Find(Class))
+		{
+			return **Cached;
+		}
+
+		TUniquePtr<FClassPropertyPlan> Plan = MakeUnique<FClassPropertyPlan>();
+		for (TFieldIterator<FProperty> PropIt(Class); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+			if (!IsPropertySafeToCopy(Property)) continue;
+
+			// Restore accepts transient properties too (hand-written or external JSON), export never writes them
+			Plan->Restorable.Add(Property->GetFName(), Property);
+
+			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient)) continue;
+
+			FCopyableProperty& Entry = Plan->Copyable.AddDefaulted_GetRef();
+			Entry.Property = Property;
+			Entry.Encoding = GetTypedEncoding(Property);
+		}
+
+		UE_LOG(LogVolumeClipboard, Verbose, TEXT("Built property plan for %s: %d copyable, %d restorable properties"), *Class->GetName(), Plan->Copyable.Num(), Plan->Restorable.Num());
+
+		return *PlanCache.Add(Class, MoveTemp(Plan));
+	}
+
+	const TArray<FCopyableProperty>& GetCopyableProperties(const UClass* Class)
+	{
+		return GetPlan(Class).Copyable;
+	}
+
+	FProperty* FindRestoreProperty(const UClass* Class, const FString& Name)
+	{
+		// FNAME_Find: a name that was never registered cannot belong to any property
+		const FName PropertyName(*Name, FNAME_Find);
+		if (PropertyName.IsNone()) return nullptr;
+
+		FProperty* const* Property = GetPlan(Class).Restorable.Find(PropertyName);
+		return Property ? *Property : nullptr;
+	}
+
+	EVolumePropertyEncoding GetTypedEncoding(const FProperty* Property)
+	{
+		// Static arrays keep going through text, which is what defines their element handling
+		if (Property->ArrayDim != 1) return EVolumePropertyEncoding::Text;
+
+		if (const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+		{
+			if (NumericProp->IsFloatingPoint()) return EVolumePropertyEncoding::Double;
+			if (NumericProp->IsInteger()) return EVolumePropertyEncoding::Int;
+		}
+		if (Property->IsA(FEnumProperty::StaticClass())) return EVolumePropertyEncoding::Int;
+		if (Property->IsA(FBoolProperty::StaticClass())) return EVolumePropertyEncoding::Bool;
+		if (Property->IsA(FNameProperty::StaticClass())) return EVolumePropertyEncoding::Name;
+
+		return EVolumePropertyEncoding::Text;
+	}
+
+	void ExportTypedValue(const FCopyableProperty& Entry, const void* ValuePtr, FVolumePropertyRecord& OutProp)
+	{
+		OutProp.Encoding = Entry.Encoding;
+
+		// The plan already classified the property, so the casts below cannot fail
+		switch (Entry.Encoding)
+		{
+		case EVolumePropertyEncoding::Int:
+			if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Entry.Property))
+			{
+				OutProp.Raw = (uint64)EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+			}
+			else
+			{
+				// Signed read of unsigned types round-trips through the same 64 bits
+				OutProp.Raw = (uint64)static_cast<const FNumericProperty*>(Entry.Property)->GetSignedIntPropertyValue(ValuePtr);
+			}
+			break;
+
+		case EVolumePropertyEncoding::Double:
+		{
+			const double Value = static_cast<const FNumericProperty*>(Entry.Property)->GetFloatingPointPropertyValue(ValuePtr);
+			FMemory::Memcpy(&OutProp.Raw, &Value, sizeof(Value));
+			break;
+		}
+
+		case EVolumePropertyEncoding::Bool:
+			OutProp.Raw = static_cast<const FBoolProperty*>(Entry.Property)->GetPropertyValue(ValuePtr) ? 1 : 0;
+			break;
+
+		case EVolumePropertyEncoding::Name:
+			OutProp.Value = static_cast<const FNameProperty*>(Entry.Property)->GetPropertyValue(ValuePtr).ToString();
+			break;
+
+		default:
+			checkNoEntry();
+			break;
+		}
+	}
+
+	bool ImportTypedValue(const FProperty* Property, void* ValuePtr, const FVolumePropertyRecord& Prop)
+	{
+		// The target class may have changed since the copy, so the property kind is checked here
+		const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property);
+		if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+		{
+			NumericProp = EnumProp->GetUnderlyingProperty();
+		}
+
+		switch (Prop.Encoding)
+		{
+		case EVolumePropertyEncoding::Int:
+			if (!NumericProp) return false;
+			if (NumericProp->IsFloatingPoint())
+			{
+				NumericProp->SetFloatingPointPropertyValue(ValuePtr, (double)(int64)Prop.Raw);
+			}
+			else
+			{
+				NumericProp->SetIntPropertyValue(ValuePtr, (int64)Prop.Raw);
+			}
+			return true;
+
+		case EVolumePropertyEncoding::Double:
+		{
+			if (!NumericProp) return false;
+			double Value;
+			FMemory::Memcpy(&Value, &Prop.Raw, sizeof(Value));
+			if (NumericProp->IsFloatingPoint())
+			{
+				NumericProp->SetFloatingPointPropertyValue(ValuePtr, Value);
+			}
+			else
+			{
+				NumericProp->SetIntPropertyValue(ValuePtr, (int64)Value);
+			}
+			return true;
+		}
+
+		case EVolumePropertyEncoding::Bool:
+			if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+			{
+				BoolProp->SetPropertyValue(ValuePtr, Prop.Raw != 0);
+				return true;
+			}
+			return false;
+
+		case EVolumePropertyEncoding::Name:
+			if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+			{
+				NameProp->SetPropertyValue(ValuePtr, FName(*Prop.Value));
+				return true;
+			}
+			return false;
+
+		default:
+			return false;
+		}
+	}
+
+	// ---------------------------------------------------------
+	// Benchmark: text vs typed round trip of the scalar properties
+	// ---------------------------------------------------------
+	static void BenchmarkClass(const UClass* Class, int32 Iterations)
+	{
+		const UObject* Defaults = Class->GetDefaultObject();
+
+		TArray<const FCopyableProperty*> Scalars;
+		for (const FCopyableProperty& Entry : GetCopyableProperties(Class))
+		{
+			if (Entry.Encoding != EVolumePropertyEncoding::Text) Scalars.Add(&Entry);
+		}
+
+		// Values are imported into scratch storage so the default object is never touched
+		TArray<void*> Scratch;
+		for (const FCopyableProperty* Entry : Scalars)
+		{
+			void* Value = FMemory::Malloc(Entry->Property->GetSize(), Entry->Property->GetMinAlignment());
+			Entry->Property->InitializeValue(Value);
+			Scratch.Add(Value);
+		}
+
+		const double TextStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			for (int32 i = 0; i < Scalars.Num(); i++)
+			{
+				const FProperty* Property = Scalars[i]->Property;
+				FString Text;
+				Property->ExportTextItem(Text, Property->ContainerPtrToValuePtr<void>(Defaults), nullptr, nullptr, PPF_None);
+				Property->ImportText(*Text, Scratch[i], PPF_None, nullptr);
+			}
+		}
+		const double TextSeconds = FPlatformTime::Seconds() - TextStart;
+
+		const double TypedStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			for (int32 i = 0; i < Scalars.Num(); i++)
+			{
+				const FProperty* Property = Scalars[i]->Property;
+				FVolumePropertyRecord Prop;
+				ExportTypedValue(*Scalars[i], Property->ContainerPtrToValuePtr<void>(Defaults), Prop);
+				ImportTypedValue(Property, Scratch[i], Prop);
+			}
+		}
+		const double TypedSeconds = FPlatformTime::Seconds() - TypedStart;
+
+		for (int32 i = 0; i < Scalars.Num(); i++)
+		{
+			Scalars[i]->Property->DestroyValue(Scratch[i]);
+			FMemory::Free(Scratch[i]);
+		}
+
+		const int32 NumValues = FMath::Max(Scalars.Num() * Iterations, 1);
+		UE_LOG(LogVolumeClipboard, Display, TEXT("%s: %d scalar properties x %d: text %.2f ms (%.1f ns/value), typed %.2f ms (%.1f ns/value), %.1fx"),
+			*Class->GetName(), Scalars.Num(), Iterations,
+			TextSeconds * 1000.0, TextSeconds * 1e9 / NumValues,
+			TypedSeconds * 1000.0, TypedSeconds * 1e9 / NumValues,
+			TypedSeconds > 0.0 ? TextSeconds / TypedSeconds : 0.0);
+	}
+
+	void Benchmark(const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10000;
+		BenchmarkClass(ALevelStreamingVolume::StaticClass(), Iterations);
+		BenchmarkClass(APostProcessVolume::StaticClass(), Iterations);
+	}
+
+	void ResetCache()
+	{
+		PlanCache.Reset();
+	}
+
+	void Startup()
+	{
+		// Hot reload and blueprint reinstancing replace classes, the cached FProperty pointers would dangle
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*>&)
+		{
+			ResetCache();
+		});
+	}
+
+	void Shutdown()
+	{
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+		ObjectsReplacedHandle.Reset();
+
+		if (BlueprintCompiledHandle.IsValid() && GEditor)
+		{
+			GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+		}
+		BlueprintCompiledHandle.Reset();
+
+		ResetCache();
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VolumeClipboardTypes.h"
+
+// ---------------------------------------------------------
+// Reflection filtering for copied properties.
+// Export list and name -> property restore map of a class are built once
+// and cached, so many volumes of the same class skip reflection entirely.
+// ---------------------------------------------------------
+namespace VolumeClipboardProperties
+{
+	struct FCopyableProperty
+	{
+		FProperty* Property = nullptr;
+
+		// Typed encoding for scalars, Text for everything that still needs ExportTextItem
+		EVolumePropertyEncoding Encoding = EVolumePropertyEncoding::Text;
+	};
+
+	/** True if the property may be exported / imported (name exclusions and supported property kinds). */
+	bool IsPropertySafeToCopy(const FProperty* Property);
+
+	/** Copyable, non-transient properties of the class in field iteration order. Cached per class. */
+	const TArray<FCopyableProperty>& GetCopyableProperties(const UClass* Class);
+
+	/** Resolves a serialized property name to a property that may be restored, or nullptr. Cached per class. */
+	FProperty* FindRestoreProperty(const UClass* Class, const FString& Name);
+
+	/** Numeric, bool, enum and name properties get a typed encoding, everything else is Text. */
+	EVolumePropertyEncoding GetTypedEncoding(const FProperty* Property);
+
+	/** Copies a scalar value into the record without text formatting. Entry.Encoding must not be Text. */
+	void ExportTypedValue(const FCopyableProperty& Entry, const void* ValuePtr, FVolumePropertyRecord& OutProp);
+
+	/** Writes a typed record value into the property. Returns false if the property kind does not accept the encoding. */
+	bool ImportTypedValue(const FProperty* Property, void* ValuePtr, const FVolumePropertyRecord& Prop);
+
+	/** Console: VolumeClipboard.BenchmarkProperties [Iterations]. Times text against typed round trips of scalar properties. */
+	void Benchmark(const TArray<FString>& Args);
+
+	/** Drops every cached plan. Called automatically on hot reload and blueprint recompile. */
+	void ResetCache();
+
+	/** Hooks / unhooks the reload and recompile notifications that invalidate the cache. */
+	void Startup();
+	void Shutdown();
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogVolumeClipboard, Log, All);
+
+// ---------------------------------------------------------
+// Plain-data description of a copied volume.
+// Every clipboard format (JSON, binary) decodes into these records
+// before anything is spawned, so the paste logic only knows one shape.
+// ---------------------------------------------------------
+
+struct FVolumeStreamLinkRecord
+{
+	FString Package;
+	int32 Slot = INDEX_NONE;
+};
+
+/** How a property value is stored. Scalars skip ExportTextItem / ImportText entirely. */
+enum class EVolumePropertyEncoding : uint8
+{
+	Text,	// Value holds ExportTextItem output (structs, arrays, object references, strings)
+	Int,	// Raw holds the integer (numeric or enum underlying value)
+	Double,	// Raw holds the bits of a double
+	Bool,	// Raw is 0 or 1
+	Name,	// Value holds the name, string-table entry in binary archives
+
+	Count
+};
+
+struct FVolumePropertyRecord
+{
+	FString Name;
+	FString Value;
+	uint64 Raw = 0;
+	EVolumePropertyEncoding Encoding = EVolumePropertyEncoding::Text;
+
+	/** Text form of the value, typed values are formatted so text-only formats (JSON) can still carry them. */
+	FString GetValueText() const
+	{
+		switch (Encoding)
+		{
+		case EVolumePropertyEncoding::Int:
+			return FString::Printf(TEXT("%lld"), (int64)Raw);
+		case EVolumePropertyEncoding::Double:
+		{
+			double DoubleValue;
+			FMemory::Memcpy(&DoubleValue, &Raw, sizeof(DoubleValue));
+			return FString::Printf(TEXT("%.17g"), DoubleValue);
+		}
+		case EVolumePropertyEncoding::Bool:
+			return Raw ? TEXT("True") : TEXT("False");
+		default:
+			return Value;
+		}
+	}
+};
+
+struct FVolumeComponentRecord
+{
+	FString ClassName;
+	TArray<FVolumePropertyRecord> Props;
+};
+
+struct FVolumePolyRecord
+{
+	uint32 Flags = 0;
+
+	// Range inside FVolumeRecord::Indices when the record is indexed, otherwise inside FVolumeRecord::Vertices
+	int32 FirstVertex = 0;
+	int32 NumVertices = 0;
+};
+
+/** Extraction settings that change what goes into a record. */
+struct FVolumeCaptureOptions
+{
+	// Near-duplicate BSP points closer than this are merged, 0 disables welding
+	float WeldTolerance = 0.0f;
+
+	// Only properties that differ from the class default / archetype are exported
+	bool bDeltaFromDefaults = false;
+
+	// Scalars are captured as raw values instead of text. Only the binary archive can carry them.
+	bool bTypedValues = false;
+
+	// Coplanar BSP fragments are merged back into faces and slivers dropped (indexed records only)
+	bool bSimplifyGeometry = false;
+
+	// Brushes matching a builder primitive are exported as builder parameters instead of polys
+	bool bDetectPrimitives = false;
+};
+
+/** Which volumes a world export visits. Empty / invalid members do not filter. */
+struct FVolumeWorldFilter
+{
+	// Level package names (/Game/Maps/Sub) or short names (Sub), empty = every loaded level
+	TArray<FString> Levels;
+
+	// Class name (TriggerVolume) or path (/Game/BP_Volume.BP_Volume_C), subclasses match too
+	FString ClassName;
+
+	// Wildcard (* and ?) matched against the actor name and label
+	FString NamePattern;
+
+	// Volumes whose bounds do not touch this box are skipped
+	FBox Bounds = FBox(ForceInit);
+};
+
+struct FVolumeRecord
+{
+	FString Class;
+	FString InternalName;
+	FString OriginLevel;
+	FString OriginLevelPackage;
+	FString BuilderType;
+
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector Scale = FVector::OneVector;
+
+	int32 SpawnMethod = 0;
+	int32 Mobility = 0;
+	int32 BrushType = 0;
+
+	// Optional fields (mirror the HasField checks of the JSON schema)
+	bool bHasOrigin = false;
+	bool bHasStreamLinks = false;
+	bool bHasRotation = false;
+	bool bHasSpawnMethod = false;
+	bool bHasMobility = false;
+	bool bHasBrushType = false;
+	bool bHasModel = false;
+	bool bIndexed = false;
+
+	TArray<FVolumeStreamLinkRecord> StreamLinks;
+	TArray<FVolumePropertyRecord> Properties;
+	TArray<FVolumeComponentRecord> Components;
+
+	// Flat vertex pool, each poly references a contiguous range of it.
+	// Indexed records (BSP node exports) store every point once and reference it through Indices.
+	TArray<FVector> Vertices;
+	TArray<int32> Indices;
+	TArray<FVolumePolyRecord> Polys;
+
+	// Set instead of the pools when BuilderType names a recognized primitive (Cube: X, Y, Z)
+	TArray<float> BuilderParams;
+	uint32 BuilderFlags = 0;
+
+	const FVector& GetPolyVertex(const FVolumePolyRecord& Poly, int32 VertexIndex) const
+	{
+		return bIndexed ? Vertices[Indices[Poly.FirstVertex + VertexIndex]] : Vertices[Poly.FirstVertex + VertexIndex];
+	}
+
+	/** True when every poly range and index is inside the pools (decoded data is untrusted). */
+	bool HasValidGeometry() const
+	{
+		const int32 RangeLimit = bIndexed ? Indices.Num() : Vertices.Num();
+		for (const FVolumePolyRecord& Poly : Polys)
+		{
+			if (Poly.FirstVertex < 0 || Poly.NumVertices < 0 || Poly.NumVertices > RangeLimit - Poly.FirstVertex) return false;
+		}
+		if (bIndexed)
+		{
+			for (int32 Index : Indices)
+			{
+				if (!Vertices.IsValidIndex(Index)) return false;
+			}
+		}
+		return true;
+	}
+
+	const FVolumePropertyRecord* FindProperty(const TCHAR* Name) const
+	{
+		return Properties.FindByPredicate([Name](const FVolumePropertyRecord& Prop) { return Prop.Name == Name; });
+	}
+};
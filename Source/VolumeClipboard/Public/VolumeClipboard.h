@@ -2,6 +2,15 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Engine/StreamableManager.h"
+
+struct FVolumeRecord;
+struct FVolumePropertyRecord;
+struct FVolumeComponentRecord;
+struct FVolumeCaptureOptions;
+struct FVolumeCaptureContext;
+struct FVolumeExtractionJob;
+struct FVolumeWorldFilter;
 
 class FVolumeClipboardModule : public IModuleInterface
 {
@@ -12,12 +21,30 @@ public:
 	void RegisterMenus();
 	void OpenPluginWindow();
 
+	/**
+	 * Writes the selected volumes to a file, streamed through an FArchive. ".json" writes JSON, anything else the binary archive.
+	 * With background extraction on, the file is written by a worker and true only means the snapshot was queued.
+	 */
+	bool ExportSelectedVolumesToFile(const FString& Filename);
+
+	/**
+	 * Writes every volume of the loaded levels that passes the filter, one file per level (<Directory>/<Level>.vclb or .json).
+	 * Walks the world with TActorIterator, the editor selection is never read or changed. Returns false if the filter is invalid.
+	 */
+	bool ExportWorldVolumesToDirectory(const FString& Directory, const FVolumeWorldFilter& Filter);
+
+	/** Pastes volumes from a file written by ExportSelectedVolumesToFile (or any volume JSON). The file is memory-mapped and parsed in place. */
+	bool ImportVolumesFromFile(const FString& Filename);
+
 private:
 	TSharedRef<class SDockTab> OnSpawnPluginTab(const class FSpawnTabArgs& SpawnTabArgs);
 
 	// Button Handlers
 	FReply OnExtractVolumesClicked();
 	FReply OnCreateVolumesClicked();
+	FReply OnExportToFileClicked();
+	FReply OnImportFromFileClicked();
+	FReply OnExportWorldClicked();
 
 	// Checkbox Handlers
 	void OnPasteLevelCheckboxChanged(ECheckBoxState NewState);
@@ -26,11 +53,103 @@ private:
 	void OnDeleteOriginalCheckboxChanged(ECheckBoxState NewState);
 	ECheckBoxState GetDeleteOriginalCheckboxState() const;
 
+	void OnBinaryFormatCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetBinaryFormatCheckboxState() const;
+
+	void OnDeltaPropertiesCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetDeltaPropertiesCheckboxState() const;
+
+	void OnBatchLevelsCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetBatchLevelsCheckboxState() const;
+
+	void OnUpdateExistingCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetUpdateExistingCheckboxState() const;
+
+	void OnCompactUndoCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetCompactUndoCheckboxState() const;
+
+	void OnBulkPasteCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetBulkPasteCheckboxState() const;
+
+	void OnSimplifyGeometryCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetSimplifyGeometryCheckboxState() const;
+
+	void OnDetectPrimitivesCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetDetectPrimitivesCheckboxState() const;
+
+	void OnBackgroundExtractionCheckboxChanged(ECheckBoxState NewState);
+	ECheckBoxState GetBackgroundExtractionCheckboxState() const;
+
+	// Numeric Handlers
+	void OnWeldToleranceChanged(float NewValue);
+	TOptional<float> GetWeldTolerance() const;
+
+	// Text Handlers
+	void OnWorldClassFilterChanged(const FText& NewText);
+	FText GetWorldClassFilter() const;
+
+	void OnWorldNameFilterChanged(const FText& NewText);
+	FText GetWorldNameFilter() const;
+
+	void OnWorldLevelFilterChanged(const FText& NewText);
+	FText GetWorldLevelFilter() const;
+
+	// Combo Handlers
+	TSharedRef<class SWidget> OnGenerateBspQualityWidget(TSharedPtr<int32> Option) const;
+	void OnBspQualityChanged(TSharedPtr<int32> NewValue, ESelectInfo::Type SelectInfo);
+	FText GetBspQualityText() const;
+
 	// Helpers
-	static void SerializeObjectProperties(UObject* Obj, TSharedPtr<class FJsonObject>& OutJson);
-	static void RestoreObjectProperties(UObject* Obj, const TSharedPtr<class FJsonObject>& InJson);
+	static void SerializeObjectProperties(UObject* Obj, const FVolumeCaptureOptions& Options, TArray<FVolumePropertyRecord>& OutProps);
+	static void RestoreObjectProperties(UObject* Obj, const TArray<FVolumePropertyRecord>& InProps);
+	static void RestoreComponentProperties(class AActor* Actor, const TArray<FVolumeComponentRecord>& InComponents, bool bResetUnlisted = false);
+	static void CaptureVolume(class AVolume* Volume, const FVolumeCaptureContext& Context, const FVolumeCaptureOptions& Options, FVolumeRecord& OutRecord);
+	static void FinishCapturedGeometry(const FVolumeCaptureOptions& Options, FVolumeRecord& Record);
+
+	FVolumeCaptureOptions MakeCaptureOptions(bool bForBinary) const;
+	FVolumeWorldFilter MakeWorldFilter() const;
+
+	// Extraction: game-thread snapshot, worker encode, clipboard / file output. Empty Filename = clipboard.
+	bool ExtractVolumes(const TArray<class AVolume*>& Volumes, bool bBinary, const FString& Filename);
+	static void EncodeExtraction(FVolumeExtractionJob& Job);
+	void CompleteExtraction(FVolumeExtractionJob& Job);
+	bool TickPendingExtractions(float DeltaTime);
+	void FlushPendingExtractions();
+
+	void PasteVolumeRecords(const TArray<FVolumeRecord>& Records);
+	void ResolveVolumeClasses(const TArray<FVolumeRecord>& Records, TMap<FString, UClass*>& OutClasses);
+
+	// Console: VolumeClipboard.BenchmarkBsp
+	void BenchmarkBspBuild();
+
+	// Console: VolumeClipboard.ExportWorld [Directory] [Class=] [Name=] [Levels=A,B] [Min=X,Y,Z Max=X,Y,Z]
+	void ExportWorldCommand(const TArray<FString>& Args);
 
 	// State
 	bool bPasteToOriginalLevel;
 	bool bDeleteOriginalActor; // New Boolean
+	bool bUpdateExisting;      // With bDeleteOriginalActor: reuse a same-class original instead of destroying it
+	bool bUseBinaryFormat;     // JSON is kept for debugging / interop
+	float WeldTolerance;       // BSP point welding on extraction, 0 = off
+	bool bDeltaFromDefaults;   // Skip properties that still have their default value
+	bool bBatchLevelLoading;   // Confirm once and load all missing sub-levels together
+	bool bSimplifyGeometry;    // Merge coplanar BSP fragments on extraction, opt-in (rewrites brush topology)
+	bool bBulkPaste;           // Skip per-actor edit notifications, update components and selection once
+	bool bCompactUndo;         // Pasted brush objects are not snapshotted into the paste transaction
+	bool bDetectPrimitives;    // Export builder-shaped brushes as builder parameters
+	bool bBackgroundExtraction; // Encode and write copies on worker threads
+	int32 BspQuality;          // FBSPOps::EBspOptimization for brushes that are not convex
+	FString WorldClassFilter;  // World export filters, empty = no filter
+	FString WorldNameFilter;
+	FString WorldLevelFilter;  // Comma separated level names
+
+	TArray<TSharedPtr<int32>> BspQualityOptions;
+	class IConsoleObject* BspBenchmarkCommand = nullptr;
+	class IConsoleObject* PropertyBenchmarkCommand = nullptr;
+	class IConsoleObject* WorldExportCommand = nullptr;
+
+	TArray<TSharedPtr<FVolumeExtractionJob>> PendingExtractions; // Oldest first
+	FDelegateHandle ExtractionTickerHandle;
+
+	FStreamableManager StreamableManager; // Batched async loads of blueprint volume classes on paste
 };
\ No newline at end of file
@@ -29,6 +29,7 @@ public class VolumeClipboard : ModuleRules
 				"Json",            // Required for serialization
 				"JsonUtilities",   // Required for JSON utilities
 				"EditorStyle",     // Required for FEditorStyle
+				"DesktopPlatform", // Required for file dialogs
 				"ApplicationCore"  // Required for Clipboard Copy/Paste
 			}
         );